@@ -0,0 +1,60 @@
+#pragma once
+// Synthetic endless-runner levels for benchmarks.
+//
+// Lays out `segments` ground segments left to right with gaps between them,
+// one platform, treasure and obstacle per segment, and writes the result in
+// the same JSON format as assets/levels/*.json.
+
+#include <nlohmann/json.hpp>
+#include <fstream>
+#include <random>
+#include <string>
+
+inline nlohmann::json generateLevel(int segments, unsigned seed = 1234) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> segLength(300.0f, 900.0f);
+    std::uniform_real_distribution<float> gapLength(60.0f, 140.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    nlohmann::json ground = nlohmann::json::array();
+    nlohmann::json platforms = nlohmann::json::array();
+    nlohmann::json treasures = nlohmann::json::array();
+    nlohmann::json obstacles = nlohmann::json::array();
+
+    float x = 0.0f;
+    for (int i = 0; i < segments; i++) {
+        float start = x;
+        float end = start + segLength(rng);
+        ground.push_back({{"start", start}, {"end", end}});
+
+        float platX = start + (end - start) * unit(rng) * 0.6f;
+        float platY = 340.0f + 80.0f * unit(rng);
+        float platW = 80.0f + 80.0f * unit(rng);
+        platforms.push_back({{"x", platX}, {"y", platY}, {"width", platW}, {"height", 20.0f}});
+        treasures.push_back({{"x", platX + platW / 2.0f}, {"y", platY - 30.0f}, {"points", 50}});
+
+        float obsX = start + (end - start) * (0.3f + 0.6f * unit(rng));
+        obstacles.push_back({{"x", obsX}, {"y", 460.0f}, {"width", 30.0f}, {"height", 40.0f}});
+
+        x = end + gapLength(rng);
+    }
+
+    return {
+        {"name", "Generated " + std::to_string(segments)},
+        {"length", x},
+        {"groundY", 500.0f},
+        {"ground", ground},
+        {"platforms", platforms},
+        {"treasures", treasures},
+        {"obstacles", obstacles}
+    };
+}
+
+inline bool writeGeneratedLevel(const std::string& path, int segments, unsigned seed = 1234) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << generateLevel(segments, seed).dump();
+    return true;
+}
@@ -0,0 +1,195 @@
+// Per-frame input cost: the Input singleton (bitset state, scancode table)
+// against the previous hash-map implementation, reproduced below as
+// MapInput. Each simulated frame runs beginFrame(), a few key events, and
+// isHeld / justPressed / justReleased for every action, the way a scene's
+// update() does. Reports ns per frame, heap allocations per frame, and
+// checks both give the same answers.
+//
+//   InputBench [--frames N]
+
+#include <SDL3/SDL.h>
+#include "Input.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <unordered_map>
+
+// Global allocation counter (counts every operator new in the process)
+static std::atomic<Uint64> allocationCount{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// The original Input: per-action bools in hash maps, copied every frame
+class MapInput {
+public:
+    MapInput() {
+        keyBindings[SDL_SCANCODE_UP] = Action::MoveUp;
+        keyBindings[SDL_SCANCODE_W] = Action::MoveUp;
+        keyBindings[SDL_SCANCODE_DOWN] = Action::MoveDown;
+        keyBindings[SDL_SCANCODE_S] = Action::MoveDown;
+        keyBindings[SDL_SCANCODE_LEFT] = Action::MoveLeft;
+        keyBindings[SDL_SCANCODE_A] = Action::MoveLeft;
+        keyBindings[SDL_SCANCODE_RIGHT] = Action::MoveRight;
+        keyBindings[SDL_SCANCODE_D] = Action::MoveRight;
+        keyBindings[SDL_SCANCODE_SPACE] = Action::Confirm;
+        keyBindings[SDL_SCANCODE_RETURN] = Action::Confirm;
+        keyBindings[SDL_SCANCODE_ESCAPE] = Action::Back;
+        keyBindings[SDL_SCANCODE_AC_BACK] = Action::Back;
+        keyBindings[SDL_SCANCODE_P] = Action::Pause;
+        for (int i = 0; i < Input::ACTION_COUNT; i++) {
+            currentState[static_cast<Action>(i)] = false;
+            previousState[static_cast<Action>(i)] = false;
+        }
+    }
+
+    void beginFrame() {
+        previousState = currentState;
+        const bool* keys = SDL_GetKeyboardState(NULL);
+        for (const auto& [scancode, action] : keyBindings) {
+            if (keys[scancode]) {
+                currentState[action] = true;
+            }
+        }
+    }
+
+    void processEvent(const SDL_Event& event) {
+        if (event.type == SDL_EVENT_KEY_DOWN) {
+            auto it = keyBindings.find(event.key.scancode);
+            if (it != keyBindings.end()) {
+                currentState[it->second] = true;
+                if (it->second == Action::Confirm || it->second == Action::MoveUp) {
+                    currentState[Action::Jump] = true;
+                }
+            }
+        } else if (event.type == SDL_EVENT_KEY_UP) {
+            auto it = keyBindings.find(event.key.scancode);
+            if (it != keyBindings.end()) {
+                currentState[it->second] = false;
+                if (it->second == Action::Confirm || it->second == Action::MoveUp) {
+                    currentState[Action::Jump] = false;
+                }
+            }
+        }
+    }
+
+    bool isHeld(Action action) const {
+        auto it = currentState.find(action);
+        return it != currentState.end() && it->second;
+    }
+    bool justPressed(Action action) const { return isHeld(action) && !wasHeld(action); }
+    bool justReleased(Action action) const { return !isHeld(action) && wasHeld(action); }
+
+private:
+    bool wasHeld(Action action) const {
+        auto it = previousState.find(action);
+        return it != previousState.end() && it->second;
+    }
+
+    std::unordered_map<SDL_Scancode, Action> keyBindings;
+    std::unordered_map<Action, bool> currentState;
+    std::unordered_map<Action, bool> previousState;
+};
+
+// Scripted key traffic: every few frames a key goes down or up
+static const SDL_Scancode SCRIPT_KEYS[] = {
+    SDL_SCANCODE_SPACE, SDL_SCANCODE_LEFT, SDL_SCANCODE_UP, SDL_SCANCODE_D, SDL_SCANCODE_F7,
+};
+
+static void scriptEvents(int frame, SDL_Event* events, int& count) {
+    count = 0;
+    const int keyCount = (int)(sizeof(SCRIPT_KEYS) / sizeof(SCRIPT_KEYS[0]));
+    for (int k = 0; k < keyCount; k++) {
+        int period = 3 + k * 2;
+        if (frame % period == 0) {
+            SDL_Event& event = events[count++];
+            SDL_zero(event);
+            event.type = (frame / period) % 2 ? SDL_EVENT_KEY_UP : SDL_EVENT_KEY_DOWN;
+            event.key.scancode = SCRIPT_KEYS[k];
+        }
+    }
+}
+
+// One frame: returns the query results packed into a word for checking
+template <typename InputT>
+static Uint32 runFrame(InputT& input, int frame) {
+    SDL_Event events[8];
+    int count = 0;
+    scriptEvents(frame, events, count);
+
+    input.beginFrame();
+    for (int i = 0; i < count; i++) {
+        input.processEvent(events[i]);
+    }
+    Uint32 bits = 0;
+    for (int i = 0; i < Input::ACTION_COUNT; i++) {
+        Action action = static_cast<Action>(i);
+        bits |= (Uint32)input.isHeld(action) << (i * 3);
+        bits |= (Uint32)input.justPressed(action) << (i * 3 + 1);
+        bits |= (Uint32)input.justReleased(action) << (i * 3 + 2);
+    }
+    return bits;
+}
+
+template <typename InputT>
+static double nsPerFrame(InputT& input, int frames, Uint64& sink, Uint64& allocations) {
+    Uint64 allocsBefore = allocationCount.load();
+    auto t0 = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        sink += runFrame(input, f);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    allocations = allocationCount.load() - allocsBefore;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / frames;
+}
+
+int main(int argc, char* argv[]) {
+    int frames = 2000000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) {
+            frames = std::atoi(argv[i + 1]);
+        }
+    }
+
+    MapInput mapInput;
+    Input& input = Input::instance();
+    input.reset();
+
+    bool match = true;
+    for (int f = 0; f < 10000 && match; f++) {
+        match = runFrame(mapInput, f) == runFrame(input, f);
+    }
+    input.reset();
+
+    Uint64 sink = 0;
+    Uint64 mapAllocs = 0;
+    Uint64 bitAllocs = 0;
+    double mapNs = nsPerFrame(mapInput, frames, sink, mapAllocs);
+    double bitNs = nsPerFrame(input, frames, sink, bitAllocs);
+
+    std::printf("InputBench: %d frames, %d actions queried 3 ways per frame\n", frames, Input::ACTION_COUNT);
+    std::printf("%-10s %12s %14s\n", "state", "ns/frame", "allocs/frame");
+    std::printf("%-10s %12.1f %14.3f\n", "hash map", mapNs, (double)mapAllocs / frames);
+    std::printf("%-10s %12.1f %14.3f\n", "bitset", bitNs, (double)bitAllocs / frames);
+    std::printf("Same results: %s\n", match ? "yes" : "NO");
+
+    if (sink == 42) std::printf(" ");  // Keep results observable
+    return match ? 0 : 1;
+}
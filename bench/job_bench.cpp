@@ -0,0 +1,136 @@
+// JobSystem overhead: what a job costs to spawn, run and steal, with jobs
+// too small for their own work to matter.
+//
+//   spawn   the main thread submits N empty jobs and waits for a job that
+//           depends on all of them (workers steal everything it queues)
+//   chain   N jobs, each depending on the one before: dependency hand-off
+//   tree    a job spawns two children and waits on both, down to N leaves:
+//           spawning and stealing from inside jobs, with waits that help
+//
+// Each runs at every worker count from 0 (inline) up to --workers, and
+// reports ns per job and the steals it took.
+//
+//   JobBench [--jobs N] [--workers N] [--runs N]
+
+#include <SDL3/SDL.h>
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+struct BenchOptions {
+    int jobs = 100000;
+    int workers = 0;  // 0 = logical cores - 1
+    int runs = 5;     // Best of
+};
+
+static BenchOptions parseArgs(int argc, char* argv[]) {
+    BenchOptions opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--jobs") == 0) {
+            opts.jobs = std::max(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--workers") == 0) {
+            opts.workers = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--runs") == 0) {
+            opts.runs = std::max(1, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+    return opts;
+}
+
+static std::atomic<int> jobsRun{0};
+
+static void spawnFlat(JobSystem& jobs, int count) {
+    std::vector<JobHandle> handles;
+    handles.reserve(count);
+    for (int i = 0; i < count; i++) {
+        handles.push_back(jobs.run([] { jobsRun.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    jobs.wait(jobs.run([] {}, handles));
+}
+
+static void spawnChain(JobSystem& jobs, int count) {
+    JobHandle previous;
+    for (int i = 0; i < count; i++) {
+        previous = jobs.run([] { jobsRun.fetch_add(1, std::memory_order_relaxed); }, {previous});
+    }
+    jobs.wait(previous);
+}
+
+static void spawnTree(JobSystem& jobs, int leaves) {
+    if (leaves <= 1) {
+        jobsRun.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    int half = leaves / 2;
+    JobHandle left = jobs.run([&jobs, half] { spawnTree(jobs, half); });
+    JobHandle right = jobs.run([&jobs, half, leaves] { spawnTree(jobs, leaves - half); });
+    jobs.wait(left);
+    jobs.wait(right);
+}
+
+struct Result {
+    double nsPerJob;
+    Uint64 steals;
+    bool complete;
+};
+
+template<typename Fn>
+static Result measure(const BenchOptions& opts, int workers, int expected, Fn body) {
+    Result best = {1e30, 0, true};
+    for (int run = 0; run < opts.runs; run++) {
+        JobSystem jobs(workers);
+        jobsRun = 0;
+        auto start = std::chrono::steady_clock::now();
+        body(jobs);
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / opts.jobs;
+        if (ns < best.nsPerJob) {
+            best.nsPerJob = ns;
+            best.steals = jobs.getStealCount();
+        }
+        best.complete = best.complete && jobsRun.load() == expected;
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions opts = parseArgs(argc, argv);
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+    int maxWorkers = opts.workers > 0 ? opts.workers : std::max(1, SDL_GetNumLogicalCPUCores() - 1);
+
+    std::printf("JobBench: %d jobs, best of %d runs, %d logical cores\n",
+                opts.jobs, opts.runs, SDL_GetNumLogicalCPUCores());
+    std::printf("  %-8s %8s %12s %10s\n", "test", "workers", "ns/job", "steals");
+    // 0 (inline), then doubling up to maxWorkers
+    std::vector<int> workerCounts = {0};
+    for (int workers = 1; workers < maxWorkers; workers *= 2) {
+        workerCounts.push_back(workers);
+    }
+    workerCounts.push_back(maxWorkers);
+
+    bool ok = true;
+    for (int workers : workerCounts) {
+        Result flat = measure(opts, workers, opts.jobs, [&](JobSystem& jobs) { spawnFlat(jobs, opts.jobs); });
+        Result chain = measure(opts, workers, opts.jobs, [&](JobSystem& jobs) { spawnChain(jobs, opts.jobs); });
+        Result tree = measure(opts, workers, opts.jobs, [&](JobSystem& jobs) {
+            jobs.wait(jobs.run([&jobs, &opts] { spawnTree(jobs, opts.jobs); }));
+        });
+        std::printf("  %-8s %8d %12.1f %10llu\n", "spawn", workers, flat.nsPerJob, (unsigned long long)flat.steals);
+        std::printf("  %-8s %8d %12.1f %10llu\n", "chain", workers, chain.nsPerJob, (unsigned long long)chain.steals);
+        std::printf("  %-8s %8d %12.1f %10llu\n", "tree", workers, tree.nsPerJob, (unsigned long long)tree.steals);
+        ok = ok && flat.complete && chain.complete && tree.complete;
+    }
+    if (!ok) {
+        std::fprintf(stderr, "JobBench: some jobs didn't run\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Level query benchmark: indexed Level::hasGroundAt / getPlatformSurfaceAt
+// against the original linear scan over every segment and platform, across
+// generated levels of increasing size.
+//
+//   LevelBench [--queries N]
+
+#include <SDL3/SDL.h>
+#include "Level.h"
+#include "LevelGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Reference implementations (the pre-index Level code)
+static bool linearHasGroundAt(const Level& level, float worldX) {
+    for (const auto& seg : level.getGround()) {
+        if (worldX >= seg.startX && worldX <= seg.endX) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static float linearPlatformSurfaceAt(const Level& level, float worldX, float playerBottomY, float velocityY) {
+    if (velocityY < 0.0f) {
+        return -1.0f;
+    }
+    for (const auto& plat : level.getPlatforms()) {
+        if (worldX >= plat.x && worldX <= plat.x + plat.width) {
+            float landingTolerance = 15.0f;
+            if (playerBottomY >= plat.y && playerBottomY <= plat.y + landingTolerance) {
+                return plat.y;
+            }
+        }
+    }
+    return -1.0f;
+}
+
+struct Query {
+    float x;
+    float bottomY;
+};
+
+template <typename Fn>
+static double timePerQuery(const std::vector<Query>& queries, Fn&& fn, int& sink) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& q : queries) {
+        sink += fn(q);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / queries.size();
+}
+
+int main(int argc, char* argv[]) {
+    int queryCount = 200000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--queries") == 0) {
+            queryCount = std::atoi(argv[i + 1]);
+        }
+    }
+
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+
+    const int sizes[] = {10, 100, 1000, 10000, 100000};
+    const char* path = "level_bench_tmp.json";
+
+    std::printf("%10s %14s %14s %14s %14s %8s\n",
+                "segments", "ground lin ns", "ground idx ns", "plat lin ns", "plat idx ns", "match");
+
+    for (int segments : sizes) {
+        if (!writeGeneratedLevel(path, segments)) {
+            std::fprintf(stderr, "Failed to write %s\n", path);
+            return 1;
+        }
+        Level level;
+        if (!level.loadFromFile(path)) {
+            return 1;
+        }
+
+        // Random probes across the whole level at platform heights
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> xDist(0.0f, level.getLength());
+        std::uniform_real_distribution<float> yDist(330.0f, 440.0f);
+        std::vector<Query> queries(queryCount);
+        for (auto& q : queries) {
+            q = {xDist(rng), yDist(rng)};
+        }
+
+        // Linear scans get fewer queries on big levels so the run stays short
+        size_t linearCount = std::min<size_t>(queries.size(), 20000000 / segments + 1000);
+        std::vector<Query> linearQueries(queries.begin(), queries.begin() + linearCount);
+
+        int sink = 0;
+        double groundLinear = timePerQuery(linearQueries,
+            [&](const Query& q) { return linearHasGroundAt(level, q.x) ? 1 : 0; }, sink);
+        double groundIndexed = timePerQuery(queries,
+            [&](const Query& q) { return level.hasGroundAt(q.x) ? 1 : 0; }, sink);
+        double platLinear = timePerQuery(linearQueries,
+            [&](const Query& q) { return (int)linearPlatformSurfaceAt(level, q.x, q.bottomY, 1.0f); }, sink);
+        double platIndexed = timePerQuery(queries,
+            [&](const Query& q) { return (int)level.getPlatformSurfaceAt(q.x, q.bottomY, 1.0f); }, sink);
+
+        bool match = true;
+        for (const auto& q : linearQueries) {
+            if (linearHasGroundAt(level, q.x) != level.hasGroundAt(q.x) ||
+                linearPlatformSurfaceAt(level, q.x, q.bottomY, 1.0f) !=
+                    level.getPlatformSurfaceAt(q.x, q.bottomY, 1.0f)) {
+                match = false;
+                break;
+            }
+        }
+
+        std::printf("%10d %14.1f %14.1f %14.1f %14.1f %8s\n",
+                    segments, groundLinear, groundIndexed, platLinear, platIndexed,
+                    match ? "yes" : "NO");
+        if (sink == 42) std::printf(" ");  // Keep results observable
+    }
+
+    std::remove(path);
+    return 0;
+}
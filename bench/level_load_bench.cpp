@@ -0,0 +1,83 @@
+// Level load benchmark: JSON parse path against the compiled, memory-mapped
+// .lvlb path, across generated levels of increasing size.
+//
+//   LevelLoadBench [--repeat N]
+
+#include <SDL3/SDL.h>
+#include "Level.h"
+#include "LevelGenerator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+template <typename Fn>
+static double averageMs(int repeat, Fn&& fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; i++) {
+        fn();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / repeat;
+}
+
+int main(int argc, char* argv[]) {
+    int repeat = 5;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--repeat") == 0) {
+            repeat = std::atoi(argv[i + 1]);
+        }
+    }
+
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+
+    const int sizes[] = {10, 1000, 10000, 100000};
+    const char* jsonPath = "level_load_bench_tmp.json";
+    const char* binaryPath = "level_load_bench_tmp.lvlb";
+
+    std::printf("%10s %12s %12s %12s %10s\n", "segments", "json ms", "lvlb ms", "speedup", "match");
+
+    for (int segments : sizes) {
+        if (!writeGeneratedLevel(jsonPath, segments)) {
+            std::fprintf(stderr, "Failed to write %s\n", jsonPath);
+            return 1;
+        }
+        {
+            Level source;
+            if (!source.loadFromFile(jsonPath) || !source.saveBinary(binaryPath)) {
+                std::fprintf(stderr, "Failed to compile %s\n", jsonPath);
+                return 1;
+            }
+        }
+
+        double jsonMs = averageMs(repeat, [&] {
+            Level level;
+            level.loadFromFile(jsonPath);
+        });
+        double binaryMs = averageMs(repeat, [&] {
+            Level level;
+            level.loadFromFile(binaryPath);
+        });
+
+        Level fromJson;
+        Level fromBinary;
+        fromJson.loadFromFile(jsonPath);
+        fromBinary.loadFromFile(binaryPath);
+        bool match = fromJson.getGround().size() == fromBinary.getGround().size() &&
+                     fromJson.getObstacles().size() == fromBinary.getObstacles().size() &&
+                     fromJson.getTreasures().size() == fromBinary.getTreasures().size();
+        for (float x = 0.0f; match && x < fromJson.getLength(); x += 37.0f) {
+            match = fromJson.hasGroundAt(x) == fromBinary.hasGroundAt(x) &&
+                    fromJson.getPlatformSurfaceAt(x, 400.0f, 1.0f) ==
+                        fromBinary.getPlatformSurfaceAt(x, 400.0f, 1.0f);
+        }
+
+        std::printf("%10d %12.3f %12.3f %11.0fx %10s\n",
+                    segments, jsonMs, binaryMs, jsonMs / binaryMs, match ? "yes" : "NO");
+    }
+
+    std::remove(jsonPath);
+    std::remove(binaryPath);
+    return 0;
+}
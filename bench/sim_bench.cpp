@@ -0,0 +1,358 @@
+// Headless simulation runner for PlayingScene.
+//
+// Drives SceneManager + PlayingScene for a number of simulated seconds at a
+// fixed tick rate with no window or renderer, feeding scripted jump input
+// through Input. Reports ticks/sec, ns per update(), update() time
+// percentiles and heap allocations per tick so simulation cost can be
+// tracked on CI machines.
+//
+// Run from the build directory (assets/ is copied next to the executable):
+//   SimBench [--seconds N] [--level N] [--tick-rate HZ] [--jump-every SEC]
+//            [--generate SEGMENTS [--chunk-width W]] [--json FILE]
+//            [--record FILE | --replay FILE] [--instances N]
+//
+// --generate plays a synthetic level with SEGMENTS ground segments (and as
+// many platforms, treasures and obstacles) instead of a numbered level.
+// --chunk-width splits it into a streamed level with chunks W wide.
+// --json also writes the results, with the full update() time histogram,
+// as one JSON object for CI to compare between runs.
+//
+// --record saves the run's input (see InputRecording); --replay plays such
+// a file back instead of the scripted jumps, for as many ticks as it
+// covers and at its tick rate. Both print a checksum of the simulation
+// state over every tick, so a replay that doesn't repeat the recorded run
+// exactly (after a collision change, say) shows up as a different number.
+//
+// Each run is its own Simulation (see Simulation.h). --instances runs N of
+// them at once, one per thread, reports their combined throughput and
+// fails unless every instance ends on the same checksum: anything left
+// shared between instances shows up as a mismatch.
+
+#include <SDL3/SDL.h>
+#include "Simulation.h"
+#include "PlayingScene.h"
+#include "FixedTimestep.h"
+#include "LevelGenerator.h"
+#include "LevelChunker.h"
+#include "FrameHistogram.h"
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Allocation counter (counts every operator new), per thread so each
+// instance only sees its own
+static thread_local Uint64 allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    allocationCount++;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+struct BenchOptions {
+    float seconds = 600.0f;
+    int level = 1;
+    float tickRate = FixedTimestep::DEFAULT_TICK_RATE;
+    float jumpEvery = 0.75f;  // Scripted input: tap jump at this interval
+    int generate = 0;         // Synthetic level size, 0 = use --level
+    float chunkWidth = 0.0f;  // Stream the synthetic level, 0 = whole file
+    std::string jsonPath;     // Machine-readable results, empty = none
+    std::string recordPath;   // Save the run's input, empty = none
+    std::string replayPath;   // Play input from a recording instead of the script
+    int instances = 1;        // Simulations run side by side, one per thread
+};
+
+static BenchOptions parseArgs(int argc, char* argv[]) {
+    BenchOptions opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--seconds") == 0) {
+            opts.seconds = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--level") == 0) {
+            opts.level = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0) {
+            opts.tickRate = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--jump-every") == 0) {
+            opts.jumpEvery = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--generate") == 0) {
+            opts.generate = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--chunk-width") == 0) {
+            opts.chunkWidth = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            opts.jsonPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--record") == 0) {
+            opts.recordPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--replay") == 0) {
+            opts.replayPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--instances") == 0) {
+            opts.instances = std::max(1, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+    return opts;
+}
+
+static SDL_Event makeJumpEvent(bool down) {
+    SDL_Event event = {};
+    event.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+    event.key.scancode = SDL_SCANCODE_SPACE;
+    return event;
+}
+
+// Everything a run needs, shared read-only between instances
+struct RunSetup {
+    std::string levelPath;
+    float step = 0.0f;
+    Uint64 totalTicks = 0;
+    Uint64 jumpInterval = 0;
+    const InputRecording* replay = nullptr;  // Input to play instead of the script
+    InputRecording* record = nullptr;        // Where to record, single instance only
+};
+
+// What one run measured
+struct RunResult {
+    Uint64 ticks = 0;
+    int restarts = 0;
+    Uint64 updateNanos = 0;
+    Uint64 tickAllocations = 0;
+    FrameHistogram updateTimes;
+    Uint32 checksum = 0;
+};
+
+static void runSimulation(const RunSetup& setup, RunResult& result) {
+    Simulation simulation;
+    SceneManager& scenes = simulation.getScenes();
+    Input& input = simulation.getInput();
+    if (setup.replay) {
+        input.startReplay(setup.replay);
+    } else if (setup.record) {
+        input.startRecording(setup.record);
+    }
+
+    scenes.push(scenes.create<PlayingScene>(setup.levelPath));
+    scenes.update(0.0f);  // Enter the scene (level load) outside the timed loop
+    input.beginFrame();
+
+    // A replay runs until Input reaches the tick the recording stopped at,
+    // which also counts the extra beginFrame() calls around restarts
+    Uint64 tick = 0;
+    for (; setup.replay ? input.getTick() < setup.replay->getLastTick() : tick < setup.totalTicks; tick++) {
+        // Whenever the run ends (game over / level complete) start a new one
+        if (!dynamic_cast<PlayingScene*>(scenes.current())) {
+            scenes.replace(scenes.create<PlayingScene>(setup.levelPath));
+            scenes.update(0.0f);
+            input.beginFrame();
+            result.restarts++;
+        }
+
+        // Scripted input: press jump for one tick every jumpInterval ticks
+        if (setup.jumpInterval && tick % setup.jumpInterval == 0) {
+            input.processEvent(makeJumpEvent(true));
+        } else if (setup.jumpInterval && tick % setup.jumpInterval == 1) {
+            input.processEvent(makeJumpEvent(false));
+        }
+
+        Uint64 allocsBefore = allocationCount;
+        auto t0 = std::chrono::steady_clock::now();
+        scenes.update(setup.step);
+        auto t1 = std::chrono::steady_clock::now();
+        result.tickAllocations += allocationCount - allocsBefore;
+
+        Uint64 nanos = static_cast<Uint64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        result.updateNanos += nanos;
+        result.updateTimes.recordNanos(nanos);
+        input.beginFrame();
+
+        if (auto* playing = dynamic_cast<PlayingScene*>(scenes.current())) {
+            result.checksum = result.checksum * 31u + playing->getStateChecksum();
+        }
+    }
+    result.ticks = tick;
+
+    input.stopRecording();
+    input.stopReplay();
+
+    // Tear down
+    while (!scenes.isEmpty()) {
+        scenes.pop();
+        scenes.update(0.0f);
+    }
+}
+
+struct InstanceRun {
+    const RunSetup* setup;
+    RunResult result;
+};
+
+static int SDLCALL runInstance(void* data) {
+    InstanceRun* run = static_cast<InstanceRun*>(data);
+    runSimulation(*run->setup, run->result);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions opts = parseArgs(argc, argv);
+
+    // Gameplay logs every treasure and death; keep only warnings and errors
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+
+    if (opts.instances > 1 && !opts.recordPath.empty()) {
+        std::fprintf(stderr, "--record needs a single instance\n");
+        return 1;
+    }
+
+    InputRecording recording;
+    if (!opts.replayPath.empty()) {
+        if (!recording.load(opts.replayPath)) {
+            std::fprintf(stderr, "Failed to load %s\n", opts.replayPath.c_str());
+            return 1;
+        }
+        opts.tickRate = recording.getTickRate();
+        opts.seconds = (float)recording.getLastTick() / opts.tickRate;
+        opts.jumpEvery = 0.0f;
+    }
+
+    FixedTimestep timestep(opts.tickRate);
+    RunSetup setup;
+    setup.step = timestep.getStep();
+    setup.totalTicks = static_cast<Uint64>(opts.seconds * timestep.getTickRate());
+    setup.jumpInterval = opts.jumpEvery > 0.0f
+        ? std::max<Uint64>(1, static_cast<Uint64>(opts.jumpEvery * timestep.getTickRate()))
+        : 0;
+
+    setup.levelPath = "assets/levels/level" + std::to_string(opts.level) + ".json";
+    if (opts.generate > 0) {
+        setup.levelPath = "sim_bench_generated.json";
+        bool written = opts.chunkWidth > 0.0f
+            ? writeChunkedLevel(generateLevel(opts.generate), setup.levelPath, opts.chunkWidth)
+            : writeGeneratedLevel(setup.levelPath, opts.generate);
+        if (!written) {
+            std::fprintf(stderr, "Failed to write %s\n", setup.levelPath.c_str());
+            return 1;
+        }
+    }
+    const std::string& levelPath = setup.levelPath;
+
+    if (!opts.replayPath.empty()) {
+        setup.replay = &recording;
+    } else if (!opts.recordPath.empty()) {
+        recording.setTickRate(timestep.getTickRate());
+        setup.record = &recording;
+    }
+
+    std::vector<InstanceRun> runs(opts.instances, InstanceRun{&setup, RunResult()});
+    for (InstanceRun& run : runs) {
+        run.result.updateTimes.setRefreshRate(timestep.getTickRate());
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+    if (opts.instances == 1) {
+        runSimulation(setup, runs[0].result);
+    } else {
+        std::vector<SDL_Thread*> threads;
+        for (InstanceRun& run : runs) {
+            threads.push_back(SDL_CreateThread(runInstance, "SimBench", &run));
+        }
+        for (SDL_Thread* thread : threads) {
+            if (!thread) {
+                std::fprintf(stderr, "Failed to start a thread: %s\n", SDL_GetError());
+                return 1;
+            }
+        }
+        for (SDL_Thread* thread : threads) {
+            SDL_WaitThread(thread, nullptr);
+        }
+    }
+    auto wallEnd = std::chrono::steady_clock::now();
+    double wallSeconds = std::chrono::duration<double>(wallEnd - wallStart).count();
+
+    if (setup.record && !recording.save(opts.recordPath)) {
+        return 1;
+    }
+
+    // Totals over every instance; an update() longer than 1.5 ticks would
+    // make the game fall behind
+    const RunResult& first = runs[0].result;
+    Uint64 totalTicks = 0;
+    Uint64 updateNanos = 0;
+    Uint64 tickAllocations = 0;
+    FrameHistogram updateTimes(timestep.getTickRate());
+    int mismatches = 0;
+    for (const InstanceRun& run : runs) {
+        totalTicks += run.result.ticks;
+        updateNanos += run.result.updateNanos;
+        tickAllocations += run.result.tickAllocations;
+        updateTimes.merge(run.result.updateTimes);
+        if (run.result.checksum != first.checksum || run.result.ticks != first.ticks) {
+            mismatches++;
+        }
+    }
+    const int restarts = first.restarts;
+    const Uint32 checksum = first.checksum;
+
+    double ticks = static_cast<double>(totalTicks ? totalTicks : 1);
+    std::printf("SimBench: %s, %.0f simulated seconds at %.0f ticks/sec\n",
+                levelPath.c_str(), opts.seconds, timestep.getTickRate());
+    if (opts.instances > 1) {
+        std::printf("  instances:        %d (totals below are over all of them)\n", opts.instances);
+    }
+    std::printf("  ticks:            %llu (%d restarts)\n",
+                static_cast<unsigned long long>(totalTicks), restarts);
+    std::printf("  wall time:        %.3f s\n", wallSeconds);
+    std::printf("  ticks/sec:        %.0f\n", ticks / wallSeconds);
+    std::printf("  ns per update():  %.1f\n", updateNanos / ticks);
+    std::printf("  update() p50/p99/max: %.2f / %.2f / %.2f us (%llu over budget)\n",
+                updateTimes.getPercentileMs(50.0) * 1000.0f, updateTimes.getPercentileMs(99.0) * 1000.0f,
+                updateTimes.getMaxMs() * 1000.0f, static_cast<unsigned long long>(updateTimes.getMissedVsync()));
+    std::printf("  allocs per tick:  %.3f\n", tickAllocations / ticks);
+    std::printf("  realtime factor:  %.0fx\n", opts.seconds * opts.instances / wallSeconds);
+    std::printf("  state checksum:   %08x\n", checksum);
+    if (mismatches > 0) {
+        std::fprintf(stderr, "SimBench: %d of %d instances diverged from the first\n",
+                     mismatches, opts.instances);
+        return 1;
+    }
+
+    if (!opts.jsonPath.empty()) {
+        nlohmann::json results = {
+            {"bench", "SimBench"},
+            {"level", levelPath},
+            {"seconds", opts.seconds},
+            {"tickRate", timestep.getTickRate()},
+            {"instances", opts.instances},
+            {"ticks", totalTicks},
+            {"restarts", restarts},
+            {"wallSeconds", wallSeconds},
+            {"nsPerUpdate", updateNanos / ticks},
+            {"allocsPerTick", tickAllocations / ticks},
+            {"stateChecksum", checksum},
+            {"updateTimes", nlohmann::json::parse(updateTimes.toJson())},
+        };
+        std::ofstream file(opts.jsonPath);
+        if (!file.is_open()) {
+            std::fprintf(stderr, "Failed to write %s\n", opts.jsonPath.c_str());
+            return 1;
+        }
+        file << results.dump(2) << "\n";
+    }
+    return 0;
+}
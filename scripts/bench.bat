@@ -0,0 +1,22 @@
+@echo off
+REM Build and run the headless simulation benchmark
+
+cd /d "%~dp0..\bench"
+
+echo === Configuring benchmark ===
+cmake -B build -S . -DCMAKE_TOOLCHAIN_FILE=C:/vcpkg/scripts/buildsystems/vcpkg.cmake
+if errorlevel 1 (
+    echo Configuration failed!
+    exit /b 1
+)
+
+echo === Building benchmark ===
+cmake --build build --config Release
+if errorlevel 1 (
+    echo Build failed!
+    exit /b 1
+)
+
+echo === Running benchmark ===
+cd build
+.\Release\SimBench.exe %*
@@ -0,0 +1,17 @@
+#!/bin/bash
+# Build and run the headless simulation benchmark
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+cd "$SCRIPT_DIR/../bench"
+
+echo "=== Configuring benchmark ==="
+cmake -B build -S . -DCMAKE_TOOLCHAIN_FILE=C:/vcpkg/scripts/buildsystems/vcpkg.cmake
+
+echo "=== Building benchmark ==="
+cmake --build build --config Release
+
+echo "=== Running benchmark ==="
+cd build
+./Release/SimBench.exe "$@"
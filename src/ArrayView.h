@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Non-owning view over a contiguous array: a std::vector's storage or a
+// region of a memory-mapped file. Supports size(), [] and range-for.
+template <typename T>
+class ArrayView {
+public:
+    ArrayView() = default;
+    ArrayView(T* data, size_t size) : ptr(data), count(size) {}
+
+    template <typename U>
+    ArrayView(std::vector<U>& vec) : ptr(vec.data()), count(vec.size()) {}
+
+    template <typename U>
+    ArrayView(const std::vector<U>& vec) : ptr(vec.data()), count(vec.size()) {}
+
+    T* begin() const { return ptr; }
+    T* end() const { return ptr + count; }
+    T* data() const { return ptr; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& operator[](size_t i) const { return ptr[i]; }
+
+private:
+    T* ptr = nullptr;
+    size_t count = 0;
+};
@@ -0,0 +1,163 @@
+#include "BitmapFont.h"
+#include "RenderStats.h"
+#include <cstring>
+
+namespace {
+    // Printable ASCII, 16 glyphs per row in 10px cells; the 1px border
+    // keeps neighbours from bleeding in at fractional scales. Power-of-two
+    // atlas so texel coordinates are exact as UVs (the software renderer
+    // turns UVs back into a source rect and would otherwise round down).
+    constexpr int FIRST_CHAR = 32;
+    constexpr int LAST_CHAR = 126;
+    constexpr int GLYPHS_PER_ROW = 16;
+    constexpr int CELL_SIZE = 10;
+    constexpr int ATLAS_WIDTH = 256;
+    constexpr int ATLAS_HEIGHT = 64;
+    static_assert(GLYPHS_PER_ROW * CELL_SIZE <= ATLAS_WIDTH, "Atlas too narrow");
+    static_assert(((LAST_CHAR - FIRST_CHAR) / GLYPHS_PER_ROW + 1) * CELL_SIZE <= ATLAS_HEIGHT, "Atlas too short");
+
+    SDL_Surface* buildGlyphSurface() {
+        SDL_Surface* surface = SDL_CreateSurface(ATLAS_WIDTH, ATLAS_HEIGHT, SDL_PIXELFORMAT_RGBA32);
+        if (!surface) {
+            SDL_Log("BitmapFont: Failed to create glyph surface: %s", SDL_GetError());
+            return nullptr;
+        }
+
+        // Let SDL rasterize its own font once, white on transparent
+        SDL_Renderer* software = SDL_CreateSoftwareRenderer(surface);
+        if (!software) {
+            SDL_Log("BitmapFont: Failed to create glyph renderer: %s", SDL_GetError());
+            SDL_DestroySurface(surface);
+            return nullptr;
+        }
+        SDL_SetRenderDrawColor(software, 0, 0, 0, 0);
+        SDL_RenderClear(software);
+        SDL_SetRenderDrawColor(software, 255, 255, 255, 255);
+        for (int c = FIRST_CHAR + 1; c <= LAST_CHAR; c++) {
+            int cell = c - FIRST_CHAR;
+            char glyph[2] = {static_cast<char>(c), '\0'};
+            SDL_RenderDebugText(software,
+                static_cast<float>((cell % GLYPHS_PER_ROW) * CELL_SIZE + 1),
+                static_cast<float>((cell / GLYPHS_PER_ROW) * CELL_SIZE + 1),
+                glyph);
+        }
+        SDL_FlushRenderer(software);
+        SDL_DestroyRenderer(software);
+        return surface;
+    }
+}
+
+BitmapFont::~BitmapFont() {
+    release();
+}
+
+BitmapFont& BitmapFont::operator=(const BitmapFont& other) {
+    if (this != &other) {
+        release();
+        clear();
+    }
+    return *this;
+}
+
+SDL_Surface* BitmapFont::getGlyphSurface() {
+    // Shared by every font and renderer; built on first use
+    static SDL_Surface* surface = buildGlyphSurface();
+    return surface;
+}
+
+void BitmapFont::addText(const char* text, float x, float y, float scale, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    const SDL_FColor color = {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+    const float size = GLYPH_SIZE * scale;
+    const float texelU = 1.0f / ATLAS_WIDTH;
+    const float texelV = 1.0f / ATLAS_HEIGHT;
+
+    float penX = x;
+    for (const char* p = text; *p; p++, penX += size) {
+        int c = static_cast<unsigned char>(*p);
+        if (c <= FIRST_CHAR) {
+            continue;  // Blank, just advance
+        }
+        if (c > LAST_CHAR) {
+            c = '?';
+        }
+
+        int cell = c - FIRST_CHAR;
+        float u0 = ((cell % GLYPHS_PER_ROW) * CELL_SIZE + 1) * texelU;
+        float v0 = ((cell / GLYPHS_PER_ROW) * CELL_SIZE + 1) * texelV;
+        float u1 = u0 + GLYPH_SIZE * texelU;
+        float v1 = v0 + GLYPH_SIZE * texelV;
+
+        // Two triangles per glyph: 0-1-2 and 2-3-0
+        int base = static_cast<int>(vertices.size());
+        vertices.push_back({{penX, y}, color, {u0, v0}});
+        vertices.push_back({{penX + size, y}, color, {u1, v0}});
+        vertices.push_back({{penX + size, y + size}, color, {u1, v1}});
+        vertices.push_back({{penX, y + size}, color, {u0, v1}});
+
+        indices.push_back(base);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+        indices.push_back(base);
+    }
+}
+
+void BitmapFont::addTextCentered(const char* text, float centerX, float y, float scale,
+                                 Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    addText(text, centerX - measure(text, scale) / 2.0f, y, scale, r, g, b, a);
+}
+
+float BitmapFont::measure(const char* text, float scale) {
+    return std::strlen(text) * GLYPH_SIZE * scale;
+}
+
+bool BitmapFont::prepare(SDL_Renderer* renderer) {
+    if (atlas && owner == renderer) {
+        return true;
+    }
+
+    release();
+    SDL_Surface* glyphs = getGlyphSurface();
+    if (!glyphs) {
+        return false;
+    }
+    atlas = SDL_CreateTextureFromSurface(renderer, glyphs);
+    if (!atlas) {
+        SDL_Log("BitmapFont: Failed to create atlas texture: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(atlas, SDL_SCALEMODE_NEAREST);
+    owner = renderer;
+    return true;
+}
+
+bool BitmapFont::flush(SDL_Renderer* renderer) {
+    if (vertices.empty()) {
+        return true;
+    }
+    bool ok = prepare(renderer) &&
+              SDL_RenderGeometry(renderer, atlas,
+                                 vertices.data(), static_cast<int>(vertices.size()),
+                                 indices.data(), static_cast<int>(indices.size()));
+    if (!ok) {
+        SDL_Log("BitmapFont: Failed to draw text: %s", SDL_GetError());
+    }
+    RenderStats::instance().record(1);
+    clear();
+    return ok;
+}
+
+void BitmapFont::clear() {
+    vertices.clear();
+    indices.clear();
+}
+
+void BitmapFont::release() {
+    if (atlas) {
+        SDL_DestroyTexture(atlas);
+        atlas = nullptr;
+    }
+    owner = nullptr;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Text drawn from a glyph atlas holding SDL's 8x8 debug font, so it looks
+// the same as SDL_RenderDebugText. Strings are laid out into one vertex
+// buffer, each with its own position, scale and color, and flush() submits
+// all of them with a single SDL_RenderGeometry call. The render scale is
+// never touched; scale is applied to the vertices.
+//
+// The atlas texture is created on the first flush for a renderer. Copies
+// start without one, so owners stay copyable.
+class BitmapFont {
+public:
+    static constexpr float GLYPH_SIZE = 8.0f;
+
+    BitmapFont() = default;
+    ~BitmapFont();
+    BitmapFont(const BitmapFont&) {}
+    BitmapFont& operator=(const BitmapFont& other);
+
+    // Queue text with its top-left at (x, y), in render coordinates
+    void addText(const char* text, float x, float y, float scale, Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
+    // Queue text horizontally centered on centerX
+    void addTextCentered(const char* text, float centerX, float y, float scale,
+                         Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
+
+    // Width of a single line, one advance per byte like SDL_RenderDebugText
+    static float measure(const char* text, float scale);
+
+    // Draw everything queued since the last flush, then clear
+    bool flush(SDL_Renderer* renderer);
+    void clear();
+
+    // Create the atlas for renderer now rather than on the first flush
+    bool prepare(SDL_Renderer* renderer);
+    // Destroy the atlas texture (render device reset)
+    void release();
+
+    size_t getGlyphCount() const { return vertices.size() / 4; }
+    bool isEmpty() const { return vertices.empty(); }
+
+private:
+    static SDL_Surface* getGlyphSurface();
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    SDL_Texture* atlas = nullptr;
+    SDL_Renderer* owner = nullptr;
+};
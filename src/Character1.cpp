@@ -1,9 +1,12 @@
 #include "Character1.h"
+#include "RenderStats.h"
 #include <cmath>
 
 Character1::Character1(float startX, float startY)
     : bottomCenterX(startX)
     , bottomY(startY)
+    , prevBottomCenterX(startX)
+    , prevBottomY(startY)
     , baseSize(64.0f)
     , breathTimer(0.0f)
     , breathSpeed(3.0f)      // Complete cycle ~2 seconds
@@ -20,19 +23,29 @@ void Character1::update(float deltaTime) {
     }
 }
 
-void Character1::render(SDL_Renderer* renderer) {
+void Character1::render(SDL_Renderer* renderer, float alpha) {
     // Calculate current size based on breathing animation
     // sin() gives -1 to 1, we want size to vary around baseSize
     float breathScale = 1.0f + std::sin(breathTimer) * breathAmount;
     float currentSize = baseSize * breathScale;
 
+    // Blend between last tick and current tick positions
+    float drawX = prevBottomCenterX * (1.0f - alpha) + bottomCenterX * alpha;
+    float drawY = prevBottomY * (1.0f - alpha) + bottomY * alpha;
+
     // Calculate top-left corner so bottom-center stays fixed
-    float x = bottomCenterX - currentSize / 2.0f;  // Center horizontally
-    float y = bottomY - currentSize;               // Grow upward from bottom
+    float x = drawX - currentSize / 2.0f;  // Center horizontally
+    float y = drawY - currentSize;         // Grow upward from bottom
 
     SDL_SetRenderDrawColor(renderer, r, g, b, 255);
     SDL_FRect rect = {x, y, currentSize, currentSize};
     SDL_RenderFillRect(renderer, &rect);
+    RenderStats::instance().record(1, 1);
+}
+
+void Character1::storePreviousPosition() {
+    prevBottomCenterX = bottomCenterX;
+    prevBottomY = bottomY;
 }
 
 void Character1::move(float dx, float dy) {
@@ -43,6 +56,9 @@ void Character1::move(float dx, float dy) {
 void Character1::setPosition(float x, float y) {
     bottomCenterX = x;
     bottomY = y;
+    // Teleport: don't interpolate across the jump
+    prevBottomCenterX = x;
+    prevBottomY = y;
 }
 
 void Character1::setColor(Uint8 red, Uint8 green, Uint8 blue) {
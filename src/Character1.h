@@ -6,7 +6,11 @@ public:
     Character1(float startX = 100.0f, float startY = 100.0f);
 
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
+    void render(SDL_Renderer* renderer, float alpha = 1.0f);
+
+    // Snapshot position at the start of a simulation tick; render() blends
+    // from this snapshot to the current position by alpha
+    void storePreviousPosition();
 
     void move(float dx, float dy);
     void setPosition(float x, float y);
@@ -28,6 +32,8 @@ public:
 private:
     float bottomCenterX;  // X position of bottom edge center
     float bottomY;        // Y position of bottom edge
+    float prevBottomCenterX;  // Position at the start of the last tick
+    float prevBottomY;
     float baseSize;     // Base size of the square
     float breathTimer;  // Timer for breathing animation
     float breathSpeed;  // How fast the breathing cycle is
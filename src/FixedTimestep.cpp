@@ -0,0 +1,40 @@
+#include "FixedTimestep.h"
+#include <algorithm>
+
+FixedTimestep::FixedTimestep(float ticksPerSecond) {
+    setTickRate(ticksPerSecond);
+}
+
+void FixedTimestep::setTickRate(float ticksPerSecond) {
+    tickRate = std::clamp(ticksPerSecond, MIN_TICK_RATE, MAX_TICK_RATE);
+    step = 1.0f / tickRate;
+    accumulator = 0.0f;
+}
+
+int FixedTimestep::advance(float frameTime) {
+    if (frameTime < 0.0f) frameTime = 0.0f;
+    if (frameTime > MAX_FRAME_TIME) frameTime = MAX_FRAME_TIME;
+
+    accumulator += frameTime;
+
+    int ticks = 0;
+    while (accumulator >= step && ticks < maxTicksPerFrame) {
+        accumulator -= step;
+        ticks++;
+    }
+
+    // Still behind after the catch-up limit: drop the backlog rather than
+    // letting it grow every frame
+    if (accumulator >= step) {
+        accumulator = 0.0f;
+    }
+
+    return ticks;
+}
+
+void FixedTimestep::getTickWindow(Uint64 nowNs, int tick, int ticks, Uint64& startNs, Uint64& endNs) const {
+    const Uint64 stepNs = (Uint64)((double)step * 1e9);
+    const Uint64 behindNs = (Uint64)((double)accumulator * 1e9) + (Uint64)(ticks - 1 - tick) * stepNs;
+    endNs = nowNs > behindNs ? nowNs - behindNs : 0;
+    startNs = endNs > stepNs ? endNs - stepNs : 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// Accumulates real frame time and hands it out as fixed-size simulation ticks.
+// Rendering uses getAlpha() to interpolate between the last two ticks.
+class FixedTimestep {
+public:
+    explicit FixedTimestep(float ticksPerSecond = DEFAULT_TICK_RATE);
+
+    // Add elapsed real time and return how many ticks to simulate this frame
+    int advance(float frameTime);
+
+    void setTickRate(float ticksPerSecond);
+    void setMaxTicksPerFrame(int maxTicks) { maxTicksPerFrame = maxTicks; }
+
+    float getTickRate() const { return tickRate; }
+    float getStep() const { return step; }
+    int getMaxTicksPerFrame() const { return maxTicksPerFrame; }
+
+    // Fraction of a tick left in the accumulator (0..1), for render interpolation
+    float getAlpha() const { return accumulator / step; }
+
+    // Real time simulated by tick `tick` of the `ticks` just returned by
+    // advance(), in nanoseconds, given the time advance() was measured up
+    // to. The last tick ends where the accumulator's leftover begins.
+    void getTickWindow(Uint64 nowNs, int tick, int ticks, Uint64& startNs, Uint64& endNs) const;
+
+    static constexpr float DEFAULT_TICK_RATE = 60.0f;
+    static constexpr float MIN_TICK_RATE = 10.0f;
+    static constexpr float MAX_TICK_RATE = 240.0f;
+    static constexpr float MAX_FRAME_TIME = 0.25f;  // Avoid spiral of death after stalls
+
+private:
+    float tickRate;
+    float step;
+    float accumulator = 0.0f;
+    int maxTicksPerFrame = 8;
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// What the game was doing during a frame, so PerformanceMonitor can blame
+// long frames on something. Work that happens inside one frame marks it;
+// work that spans frames (a level loading on a worker) is active from
+// begin() to end() and marks every frame in between. Any thread may report.
+class FrameActivity {
+public:
+    enum Flag : Uint32 {
+        SceneTransition = 1u << 0,
+        LevelLoad = 1u << 1,
+        FileIO = 1u << 2,
+    };
+    static constexpr int FLAG_COUNT = 3;
+
+    static FrameActivity& instance() {
+        static FrameActivity activity;
+        return activity;
+    }
+
+    void mark(Uint32 flags) {
+        int old;
+        do {
+            old = SDL_GetAtomicInt(&marked);
+        } while (!SDL_CompareAndSwapAtomicInt(&marked, old, old | static_cast<int>(flags)));
+    }
+
+    void begin(Flag flag) { SDL_AddAtomicInt(&active[indexOf(flag)], 1); }
+    void end(Flag flag) {
+        SDL_AddAtomicInt(&active[indexOf(flag)], -1);
+        mark(flag);  // Still counts for the frame it finished in
+    }
+
+    // Everything that touched the frame just ended; clears the marks
+    Uint32 consume() {
+        Uint32 flags = static_cast<Uint32>(SDL_SetAtomicInt(&marked, 0));
+        for (int i = 0; i < FLAG_COUNT; i++) {
+            if (SDL_GetAtomicInt(&active[i]) > 0) {
+                flags |= 1u << i;
+            }
+        }
+        return flags;
+    }
+
+    static const char* getName(int index) {
+        static const char* const names[FLAG_COUNT] = {"scene", "load", "io"};
+        return index >= 0 && index < FLAG_COUNT ? names[index] : "?";
+    }
+
+private:
+    FrameActivity() = default;
+
+    static int indexOf(Flag flag) {
+        int index = 0;
+        while ((1u << index) != flag) {
+            index++;
+        }
+        return index;
+    }
+
+    SDL_AtomicInt marked = {0};
+    SDL_AtomicInt active[FLAG_COUNT] = {};
+};
+
+// Reports an activity for the lifetime of the enclosing block
+class FrameActivityScope {
+public:
+    explicit FrameActivityScope(FrameActivity::Flag flag) : flag(flag) { FrameActivity::instance().begin(flag); }
+    ~FrameActivityScope() { FrameActivity::instance().end(flag); }
+
+    FrameActivityScope(const FrameActivityScope&) = delete;
+    FrameActivityScope& operator=(const FrameActivityScope&) = delete;
+
+private:
+    FrameActivity::Flag flag;
+};
@@ -0,0 +1,142 @@
+#include "FrameHistogram.h"
+#include <cmath>
+#include <cstdio>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+void FrameHistogram::setRefreshRate(float hz) {
+    vsyncIntervalNs = 1000000000.0 / (hz > 0.0f ? hz : 60.0f);
+}
+
+int FrameHistogram::bucketIndex(Uint64 nanos) {
+    if (nanos < SUB_BUCKETS) {
+        return static_cast<int>(nanos);  // 1ns wide
+    }
+    Uint32 high = static_cast<Uint32>(nanos >> 32);
+    int msb = high ? 32 + SDL_MostSignificantBitIndex32(high)
+                   : SDL_MostSignificantBitIndex32(static_cast<Uint32>(nanos));
+    int shift = msb - SUB_BUCKET_BITS;
+    if (shift >= MAGNITUDES) {
+        return BUCKET_COUNT - 1;
+    }
+    int sub = static_cast<int>(nanos >> shift) - SUB_BUCKETS;
+    return (shift + 1) * SUB_BUCKETS + sub;
+}
+
+Uint64 FrameHistogram::bucketUpperBound(int index) {
+    if (index < SUB_BUCKETS) {
+        return static_cast<Uint64>(index);
+    }
+    int shift = index / SUB_BUCKETS - 1;
+    Uint64 lower = static_cast<Uint64>(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return lower + (Uint64(1) << shift) - 1;
+}
+
+void FrameHistogram::record(float frameSeconds, Uint32 activity) {
+    recordNanos(frameSeconds > 0.0f ? static_cast<Uint64>(frameSeconds * 1e9 + 0.5) : 0, activity);
+}
+
+void FrameHistogram::recordNanos(Uint64 nanos, Uint32 activity) {
+    buckets[bucketIndex(nanos)]++;
+    count++;
+    totalNs += static_cast<double>(nanos);
+    if (nanos > maxNs) {
+        maxNs = nanos;
+    }
+
+    if (nanos > vsyncIntervalNs * 1.5) {
+        missedVsync++;
+        bool attributed = false;
+        for (int i = 0; i < FrameActivity::FLAG_COUNT; i++) {
+            if (activity & (1u << i)) {
+                missedBy[i]++;
+                attributed = true;
+            }
+        }
+        if (!attributed) {
+            missedBy[FrameActivity::FLAG_COUNT]++;
+        }
+    }
+}
+
+void FrameHistogram::reset() {
+    double interval = vsyncIntervalNs;
+    *this = FrameHistogram();
+    vsyncIntervalNs = interval;
+}
+
+void FrameHistogram::merge(const FrameHistogram& other) {
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    maxNs = SDL_max(maxNs, other.maxNs);
+    totalNs += other.totalNs;
+    missedVsync += other.missedVsync;
+    for (int i = 0; i <= FrameActivity::FLAG_COUNT; i++) {
+        missedBy[i] += other.missedBy[i];
+    }
+}
+
+float FrameHistogram::getPercentileMs(double percentile) const {
+    if (count == 0) {
+        return 0.0f;
+    }
+    Uint64 target = static_cast<Uint64>(std::ceil(percentile / 100.0 * (double)count));
+    if (target < 1) {
+        target = 1;
+    }
+    Uint64 seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            Uint64 value = bucketUpperBound(i);
+            return (float)((value < maxNs ? value : maxNs) / 1000000.0);
+        }
+    }
+    return getMaxMs();
+}
+
+std::string FrameHistogram::summary() const {
+    char text[256];
+    int length = std::snprintf(text, sizeof(text), "n=%llu p50=%.1f p95=%.1f p99=%.1f max=%.1fms missed=%llu",
+                               (unsigned long long)count, getPercentileMs(50.0), getPercentileMs(95.0),
+                               getPercentileMs(99.0), getMaxMs(), (unsigned long long)missedVsync);
+    if (missedVsync > 0) {
+        const char* separator = " (";
+        for (int i = 0; i <= FrameActivity::FLAG_COUNT && length < (int)sizeof(text); i++) {
+            if (missedBy[i] > 0) {
+                const char* name = i < FrameActivity::FLAG_COUNT ? FrameActivity::getName(i) : "other";
+                length += std::snprintf(text + length, sizeof(text) - length, "%s%s %llu",
+                                        separator, name, (unsigned long long)missedBy[i]);
+                separator = " ";
+            }
+        }
+        if (length < (int)sizeof(text)) {
+            std::snprintf(text + length, sizeof(text) - length, ")");
+        }
+    }
+    return text;
+}
+
+std::string FrameHistogram::toJson() const {
+    json missedBreakdown = json::object();
+    for (int i = 0; i < FrameActivity::FLAG_COUNT; i++) {
+        missedBreakdown[FrameActivity::getName(i)] = missedBy[i];
+    }
+    missedBreakdown["other"] = missedBy[FrameActivity::FLAG_COUNT];
+
+    json out = {
+        {"frames", count},
+        {"meanMs", getMeanMs()},
+        {"p50Ms", getPercentileMs(50.0)},
+        {"p95Ms", getPercentileMs(95.0)},
+        {"p99Ms", getPercentileMs(99.0)},
+        {"maxMs", getMaxMs()},
+        {"vsyncIntervalMs", getVsyncIntervalMs()},
+        {"missedVsync", missedVsync},
+        {"missedVsyncBy", missedBreakdown},
+    };
+    return out.dump();
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "FrameActivity.h"
+#include <string>
+
+// Streaming frame-time histogram with HdrHistogram-style log-linear buckets:
+// each power of two is split into 32 linear sub-buckets, so any recorded
+// time is known to within ~3% from 1ns up to several minutes, in a fixed
+// 4.5KB table with no allocation.
+//
+// Frames longer than 1.5 vsync intervals count as missed vsync, and each
+// one is attributed to the FrameActivity flags recorded with it (or to
+// nothing, if no flag was set).
+class FrameHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 5;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int MAGNITUDES = 34;  // Up to 2^39ns, about 9 minutes
+    static constexpr int BUCKET_COUNT = (MAGNITUDES + 1) * SUB_BUCKETS;
+
+    explicit FrameHistogram(float refreshRate = 60.0f) { setRefreshRate(refreshRate); }
+
+    void setRefreshRate(float hz);
+    float getVsyncIntervalMs() const { return (float)(vsyncIntervalNs / 1000000.0); }
+
+    void record(float frameSeconds, Uint32 activity = 0);
+    void recordNanos(Uint64 nanos, Uint32 activity = 0);
+    void reset();
+    // Add another histogram's samples (one per thread, say); keeps our vsync interval
+    void merge(const FrameHistogram& other);
+
+    Uint64 getCount() const { return count; }
+    float getPercentileMs(double percentile) const;  // 0..100
+    float getMaxMs() const { return (float)(maxNs / 1000000.0); }
+    float getMeanMs() const { return count ? (float)(totalNs / (double)count / 1000000.0) : 0.0f; }
+
+    Uint64 getMissedVsync() const { return missedVsync; }
+    // Missed frames that had the activity flag at index set; an index of
+    // FrameActivity::FLAG_COUNT means frames with no activity
+    Uint64 getMissedVsyncFor(int activityIndex) const { return missedBy[activityIndex]; }
+
+    // One line for the log: "n=300 p50=16.7 p95=17.1 p99=33.4 max=41.0ms missed=2 (scene 1 load 1)"
+    std::string summary() const;
+    // Machine-readable object with the same numbers, for benchmark runs
+    std::string toJson() const;
+
+    static int bucketIndex(Uint64 nanos);
+    static Uint64 bucketUpperBound(int index);  // Largest value mapped to the bucket
+
+private:
+    Uint32 buckets[BUCKET_COUNT] = {};
+    Uint64 count = 0;
+    Uint64 maxNs = 0;
+    double totalNs = 0.0;
+    double vsyncIntervalNs = 0.0;
+    Uint64 missedVsync = 0;
+    Uint64 missedBy[FrameActivity::FLAG_COUNT + 1] = {};
+};
@@ -0,0 +1,39 @@
+#include "FramePacer.h"
+#include "Profiler.h"
+
+void FramePacer::workFinished(Uint64 nowNs) {
+    workNs[workNext] = nowNs > startNs ? nowNs - startNs : 0;
+    workNext = (workNext + 1) % HISTORY;
+    if (workCount < HISTORY) {
+        workCount++;
+    }
+}
+
+Uint64 FramePacer::getWorkEstimateNs() const {
+    Uint64 longest = 0;
+    for (int i = 0; i < workCount; i++) {
+        longest = SDL_max(longest, workNs[i]);
+    }
+    return longest;
+}
+
+Uint64 FramePacer::getWaitNs(Uint64 nowNs) const {
+    if (!enabled || frameIntervalNs == 0 || workCount == 0 || presentedNs == 0) {
+        return 0;
+    }
+    // Start so the work ends a margin before the refresh after the last one
+    Uint64 budget = getWorkEstimateNs() + MARGIN_NS;
+    if (budget >= frameIntervalNs) {
+        return 0;
+    }
+    Uint64 startAt = presentedNs + frameIntervalNs - budget;
+    return startAt > nowNs ? startAt - nowNs : 0;
+}
+
+void FramePacer::wait() {
+    Uint64 waitNs = getWaitNs(SDL_GetTicksNS());
+    if (waitNs > 0) {
+        PROFILE_SCOPE("PaceWait");
+        SDL_DelayPrecise(waitNs);
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// Opt-in low-latency pacing. With vsync on, SDL_RenderPresent returns
+// around a refresh and the loop polls input straight away, so a press that
+// arrives just after the poll waits most of a refresh before anything
+// looks at it. The pacer sleeps after present instead, so polling, the
+// update and rendering run as late as possible before the next refresh:
+// it keeps the longest frame cost (poll to present call) of the last
+// HISTORY frames and waits out the rest of the interval, less MARGIN_NS.
+//
+// It only pays off when present really blocks on the refresh; with a deep
+// swap chain queue LatencyTracker will show no gain.
+class FramePacer {
+public:
+    static constexpr int HISTORY = 30;
+    static constexpr Uint64 MARGIN_NS = 2000000;
+
+    void setEnabled(bool enable) { enabled = enable; }
+    bool isEnabled() const { return enabled; }
+
+    // Display refresh interval times the vsync interval; 0 (no vsync)
+    // turns pacing off
+    void setFrameInterval(Uint64 ns) { frameIntervalNs = ns; }
+    Uint64 getFrameInterval() const { return frameIntervalNs; }
+
+    // Frame work starts (before polling input) and ends (before present)
+    void frameStarted(Uint64 nowNs) { startNs = nowNs; }
+    void workFinished(Uint64 nowNs);
+    void framePresented(Uint64 nowNs) { presentedNs = nowNs; }
+
+    // How long to sleep before the next frameStarted(), 0 if there's no
+    // slack or pacing is off
+    Uint64 getWaitNs(Uint64 nowNs) const;
+    void wait();
+
+    Uint64 getWorkEstimateNs() const;
+
+private:
+    bool enabled = false;
+    Uint64 frameIntervalNs = 0;
+    Uint64 startNs = 0;
+    Uint64 presentedNs = 0;
+
+    Uint64 workNs[HISTORY] = {};
+    int workNext = 0;
+    int workCount = 0;
+};
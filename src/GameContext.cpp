@@ -0,0 +1,16 @@
+#include "GameContext.h"
+#include "SceneManager.h"
+#include "Input.h"
+#include "PerfOverlay.h"
+
+GameContext& GameContext::global() {
+    static GameContext context = {
+        &SceneManager::instance(),
+        &Input::instance(),
+        &PerfOverlay::instance(),
+        &JobSystem::instance(),
+        "highscore.dat",
+        nullptr,
+    };
+    return context;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "JobSystem.h"
+#include <string>
+
+class SceneManager;
+class Input;
+class PerfOverlay;
+
+// Everything a scene reaches outside itself. The windowed game runs on
+// global(), which points at the process-wide singletons. A headless
+// Simulation owns its own scene stack and input and leaves the
+// process-wide parts out, so any number can run at once, each on its own
+// thread.
+//
+// FrameActivity and the profiler's events stay global; both are safe to
+// report to from any thread.
+struct GameContext {
+    SceneManager* scenes = nullptr;
+    Input* input = nullptr;
+    PerfOverlay* overlay = nullptr;  // Debug overlay, windowed game only
+    JobSystem* jobs = nullptr;       // For loading and file I/O
+    std::string highScoreFile;       // Empty: high scores aren't read or saved
+    JobHandle highScoreSave;         // Latest save; reads and later saves wait for it
+
+    static GameContext& global();
+};
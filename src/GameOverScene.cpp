@@ -1,11 +1,14 @@
 #include "GameOverScene.h"
 #include "IntroScene.h"
+#include "Input.h"
 #include "DisplayManager.h"
 #include <cstdlib>
+#include <cstdio>
 
 void GameOverScene::onEnter() {
     SDL_Log("GameOverScene: Enter (%s)", playerWon ? "WIN" : "LOSE");
     timer = 0.0f;
+    getScenes().prepare<IntroScene>();
 
     // Initialize blocks with random positions and velocities
     for (int i = 0; i < numBlocks; i++) {
@@ -47,17 +50,10 @@ void GameOverScene::onEnter() {
     }
 }
 
-void GameOverScene::handleEvent(const SDL_Event& event) {
-    if (event.type == SDL_EVENT_KEY_DOWN ||
-        event.type == SDL_EVENT_FINGER_DOWN ||
-        event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-        requestReplace<IntroScene>();
-    }
-}
-
 void GameOverScene::update(float deltaTime) {
+    PROFILE_SCOPE("GameOverScene::update");
     timer += deltaTime;
-    if (timer > 10.0f) {
+    if (timer > 10.0f || getInput().anyInput()) {
         requestReplace<IntroScene>();
     }
 
@@ -85,6 +81,7 @@ void GameOverScene::update(float deltaTime) {
 }
 
 void GameOverScene::render(SDL_Renderer* renderer) {
+    PROFILE_SCOPE("GameOverScene::render");
     // Background color
     if (playerWon) {
         SDL_SetRenderDrawColor(renderer, 30, 80, 30, 255);  // Dark green
@@ -98,67 +95,36 @@ void GameOverScene::render(SDL_Renderer* renderer) {
         blocks[i].render(renderer);
     }
 
-    // Draw main text (at actual y ~80)
-    SDL_SetRenderScale(renderer, 4.0f, 4.0f);
+    // Draw main text
     if (playerWon) {
-        SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255);  // Gold
-        SDL_RenderDebugText(renderer, 50, 20, "YOU WIN!");
+        text.addText("YOU WIN!", 200, 80, 4.0f, 255, 215, 0);  // Gold
     } else {
-        SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255);  // Light red
-        SDL_RenderDebugText(renderer, 40, 20, "GAME OVER");
+        text.addText("GAME OVER", 160, 80, 4.0f, 255, 100, 100);  // Light red
     }
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
 
-    // Draw scores (at actual y ~180 and ~230)
+    // Draw scores
+    const float centerX = DisplayManager::DESIGN_WIDTH / 2.0f;
     char scoreText[64];
-    const float scoreScale = 2.0f;
-    SDL_SetRenderScale(renderer, scoreScale, scoreScale);
-
-    // Current score
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     snprintf(scoreText, sizeof(scoreText), "SCORE: %d", finalScore);
-    float scoreWidth = strlen(scoreText) * 8.0f;
-    float scoreX = (DisplayManager::DESIGN_WIDTH / scoreScale - scoreWidth) / 2.0f;
-    SDL_RenderDebugText(renderer, scoreX, 90, scoreText);  // actual y = 180
+    text.addTextCentered(scoreText, centerX, 180, 2.0f, 255, 255, 255);
 
     // High score (highlighted if new)
     bool isNewHighScore = (finalScore >= highScore && finalScore > 0);
     if (isNewHighScore) {
-        SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255);  // Gold for new high score
-        snprintf(scoreText, sizeof(scoreText), "NEW HIGH SCORE!");
+        text.addTextCentered("NEW HIGH SCORE!", centerX, 230, 2.0f, 255, 215, 0);  // Gold
     } else {
-        SDL_SetRenderDrawColor(renderer, 180, 180, 180, 255);
         snprintf(scoreText, sizeof(scoreText), "HIGH SCORE: %d", highScore);
+        text.addTextCentered(scoreText, centerX, 230, 2.0f, 180, 180, 180);
     }
-    float highScoreWidth = strlen(scoreText) * 8.0f;
-    float highScoreX = (DisplayManager::DESIGN_WIDTH / scoreScale - highScoreWidth) / 2.0f;
-    SDL_RenderDebugText(renderer, highScoreX, 115, scoreText);  // actual y = 230
 
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
-
-    // Draw subtitle (at actual y ~310)
-    const float subtitleScale = 1.5f;
-    SDL_SetRenderScale(renderer, subtitleScale, subtitleScale);
-    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-    if (playerWon) {
-        float subtitleWidth = 16 * 8.0f;  // "Congratulations!" is 16 chars
-        float subtitleX = (DisplayManager::DESIGN_WIDTH / subtitleScale - subtitleWidth) / 2.0f;
-        SDL_RenderDebugText(renderer, subtitleX, 207, "Congratulations!");
-    } else {
-        float subtitleWidth = 21 * 8.0f;  // "Better luck next time" is 21 chars
-        float subtitleX = (DisplayManager::DESIGN_WIDTH / subtitleScale - subtitleWidth) / 2.0f;
-        SDL_RenderDebugText(renderer, subtitleX, 207, "Better luck next time");
-    }
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    // Draw subtitle
+    const char* subtitle = playerWon ? "Congratulations!" : "Better luck next time";
+    text.addTextCentered(subtitle, centerX, 310.5f, 1.5f, 200, 200, 200);
 
-    // Draw "Press any key" with blinking effect (at actual y ~500)
+    // Draw "Press any key" with blinking effect
     int blink = (int)(timer * 2) % 2;
     if (blink == 0) {
-        SDL_SetRenderScale(renderer, 2.0f, 2.0f);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        float pressWidth = 13 * 8.0f;  // "Press any key" is 13 chars
-        float pressX = (DisplayManager::DESIGN_WIDTH / 2.0f - pressWidth) / 2.0f;
-        SDL_RenderDebugText(renderer, pressX, 250, "Press any key");
-        SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+        text.addTextCentered("Press any key", centerX, 500, 2.0f, 255, 255, 255);
     }
+    text.flush(renderer);
 }
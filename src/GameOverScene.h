@@ -1,17 +1,24 @@
 #pragma once
 #include "SceneManager.h"
 #include "Character1.h"
+#include "BitmapFont.h"
 #include <array>
 
 class GameOverScene : public Scene {
 public:
     explicit GameOverScene(bool won, int finalScore = 0, int highScore = 0)
         : playerWon(won), finalScore(finalScore), highScore(highScore) {}
+    void reuse(bool won, int score = 0, int best = 0) {
+        playerWon = won;
+        finalScore = score;
+        highScore = best;
+    }
 
     void onEnter() override;
-    void handleEvent(const SDL_Event& event) override;
     void update(float deltaTime) override;
     void render(SDL_Renderer* renderer) override;
+    bool isOpaque() const override { return true; }
+    void warmUp(SDL_Renderer* renderer) override { text.prepare(renderer); }
 
 private:
     bool playerWon;
@@ -23,4 +30,5 @@ private:
     std::array<Character1, numBlocks> blocks;
     std::array<float, numBlocks> velocityX;
     std::array<float, numBlocks> velocityY;
+    BitmapFont text;
 };
@@ -0,0 +1,74 @@
+#include "HudTexture.h"
+#include "RenderStats.h"
+
+HudTexture::~HudTexture() {
+    release();
+}
+
+HudTexture& HudTexture::operator=(const HudTexture& other) {
+    if (this != &other) {
+        release();
+    }
+    return *this;
+}
+
+void HudTexture::release() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    owner = nullptr;
+    textureWidth = 0;
+    textureHeight = 0;
+    valid = false;
+}
+
+bool HudTexture::prepare(SDL_Renderer* renderer, int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    if (texture && owner == renderer && width == textureWidth && height == textureHeight) {
+        return true;
+    }
+
+    // First use, a new renderer, or the element changed size
+    release();
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!texture) {
+        SDL_Log("HudTexture: Render targets unavailable, drawing directly: %s", SDL_GetError());
+        failed = true;
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    owner = renderer;
+    textureWidth = width;
+    textureHeight = height;
+    return true;
+}
+
+bool HudTexture::beginDraw(SDL_Renderer* renderer, SDL_Texture*& previousTarget) {
+    previousTarget = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, texture)) {
+        SDL_Log("HudTexture: SDL_SetRenderTarget failed: %s", SDL_GetError());
+        release();
+        failed = true;
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    RenderStats::instance().record(1, 2);
+    redrawCount++;
+    return true;
+}
+
+void HudTexture::endDraw(SDL_Renderer* renderer, SDL_Texture* previousTarget) {
+    SDL_SetRenderTarget(renderer, previousTarget);
+    RenderStats::instance().record(0, 1);
+}
+
+void HudTexture::present(SDL_Renderer* renderer, float x, float y) {
+    SDL_FRect dst = {x, y, static_cast<float>(textureWidth), static_cast<float>(textureHeight)};
+    SDL_RenderTexture(renderer, texture, nullptr, &dst);
+    RenderStats::instance().record(1);
+}
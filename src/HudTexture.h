@@ -0,0 +1,66 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// A HUD element drawn once into a texture and redrawn only when its key
+// (whatever value it displays) changes; every other frame it costs one
+// textured quad.
+//
+// render() calls draw(renderer, originX, originY) to rasterize the element
+// with its top-left at the origin. Normally that is (0, 0) inside the
+// texture; if render targets aren't available it is (x, y) on the current
+// target every frame, as before.
+//
+// Copies start with an empty cache, so owners stay copyable.
+class HudTexture {
+public:
+    HudTexture() = default;
+    ~HudTexture();
+    HudTexture(const HudTexture&) {}
+    HudTexture& operator=(const HudTexture& other);
+
+    template <typename Fn>
+    void render(SDL_Renderer* renderer, Uint64 key, float x, float y, float width, float height, Fn&& draw);
+
+    // Force a redraw next frame / destroy the texture (render device reset)
+    void invalidate() { valid = false; }
+    void release();
+
+    int getRedrawCount() const { return redrawCount; }
+    void resetRedrawCount() { redrawCount = 0; }
+
+private:
+    bool prepare(SDL_Renderer* renderer, int width, int height);
+    bool beginDraw(SDL_Renderer* renderer, SDL_Texture*& previousTarget);
+    void endDraw(SDL_Renderer* renderer, SDL_Texture* previousTarget);
+    void present(SDL_Renderer* renderer, float x, float y);
+
+    SDL_Texture* texture = nullptr;
+    SDL_Renderer* owner = nullptr;
+    int textureWidth = 0;
+    int textureHeight = 0;
+    Uint64 drawnKey = 0;
+    bool valid = false;
+    bool failed = false;  // No render target support, draw directly
+    int redrawCount = 0;
+};
+
+// Implementation
+template <typename Fn>
+void HudTexture::render(SDL_Renderer* renderer, Uint64 key, float x, float y, float width, float height, Fn&& draw) {
+    if (failed || !prepare(renderer, static_cast<int>(width), static_cast<int>(height))) {
+        draw(renderer, x, y);
+        return;
+    }
+    if (!valid || key != drawnKey) {
+        SDL_Texture* previousTarget = nullptr;
+        if (!beginDraw(renderer, previousTarget)) {
+            draw(renderer, x, y);
+            return;
+        }
+        draw(renderer, 0.0f, 0.0f);
+        endDraw(renderer, previousTarget);
+        drawnKey = key;
+        valid = true;
+    }
+    present(renderer, x, y);
+}
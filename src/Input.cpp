@@ -1,6 +1,15 @@
 #include "Input.h"
+#include "LatencyTracker.h"
+
+Input::Input(bool devices) : devices(devices) {
+    SDL_memset(keyActions, UNBOUND, sizeof(keyActions));
+    for (int i = 0; i < ACTION_COUNT; i++) {
+        actionTriggers[i] = 1u << i;
+    }
+    // Jump triggers on the same keys as Confirm, and on Up
+    actionTriggers[bit(Action::Confirm)] |= mask(Action::Jump);
+    actionTriggers[bit(Action::MoveUp)] |= mask(Action::Jump);
 
-Input::Input() {
     // Default key bindings
     bindKey(SDL_SCANCODE_UP, Action::MoveUp);
     bindKey(SDL_SCANCODE_W, Action::MoveUp);
@@ -15,93 +24,260 @@ Input::Input() {
     bindKey(SDL_SCANCODE_ESCAPE, Action::Back);
     bindKey(SDL_SCANCODE_AC_BACK, Action::Back);  // Android back button
     bindKey(SDL_SCANCODE_P, Action::Pause);
-
-    // Jump uses same keys as Confirm + Up arrow
-    // (can't bind same key to multiple actions, so we'll check both in game code)
-
-    // Initialize all actions to not pressed
-    for (int i = 0; i <= static_cast<int>(Action::Jump); i++) {
-        Action action = static_cast<Action>(i);
-        currentState[action] = false;
-        previousState[action] = false;
-    }
 }
 
 void Input::bindKey(SDL_Scancode key, Action action) {
-    keyBindings[key] = action;
+    if (keyActions[key] == UNBOUND) {
+        if (boundKeyCount >= MAX_BOUND_KEYS) {
+            SDL_Log("Input: Too many key bindings, %d ignored", (int)key);
+            return;
+        }
+        boundKeys[boundKeyCount++] = key;
+    }
+    keyActions[key] = static_cast<Uint8>(action);
 }
 
 void Input::beginFrame() {
-    // Copy current state to previous state
-    previousState = currentState;
+    if (recording) {
+        recordTick();  // What the tick just run saw
+    }
+    tick++;
+
+    previous = current;
     confirmInputThisFrame = false;
+    anyInputThisFrame = false;
+
+    if (replay) {
+        replayTick();
+        return;
+    }
 
     // Also check keyboard state for held keys (for continuous movement)
-    const bool* keys = SDL_GetKeyboardState(NULL);
-    for (const auto& [scancode, action] : keyBindings) {
-        if (keys[scancode]) {
-            currentState[action] = true;
+    if (devices) {
+        const bool* keys = SDL_GetKeyboardState(NULL);
+        for (int i = 0; i < boundKeyCount; i++) {
+            SDL_Scancode key = boundKeys[i];
+            current |= static_cast<Uint32>(keys[key]) << keyActions[key];
         }
     }
+
+    // Events up to the end of the tick just run are spent, used or not
+    if (tickEnd == 0) {
+        queueCount = 0;
+    }
+    while (queueCount > 0 && queue[queueHead].timestamp < tickEnd) {
+        queueHead = (queueHead + 1) % EVENT_QUEUE_SIZE;
+        queueCount--;
+    }
 }
 
 void Input::processEvent(const SDL_Event& event) {
-    if (event.type == SDL_EVENT_KEY_DOWN) {
-        auto it = keyBindings.find(event.key.scancode);
-        if (it != keyBindings.end()) {
-            setActionState(it->second, true);
-            if (it->second == Action::Confirm) {
-                confirmInputThisFrame = true;
-                // Jump triggers on same keys as Confirm
-                setActionState(Action::Jump, true);
-            }
-            // Up arrow also triggers Jump
-            if (it->second == Action::MoveUp) {
-                setActionState(Action::Jump, true);
-            }
-        }
+    if (replay) {
+        return;
     }
-    else if (event.type == SDL_EVENT_KEY_UP) {
-        auto it = keyBindings.find(event.key.scancode);
-        if (it != keyBindings.end()) {
-            setActionState(it->second, false);
-            if (it->second == Action::Confirm || it->second == Action::MoveUp) {
-                setActionState(Action::Jump, false);
-            }
+    // Synthesized events (tests, benchmarks) may not carry a time
+    Uint64 timestamp = event.common.timestamp ? event.common.timestamp : SDL_GetTicksNS();
+
+    if (event.type == SDL_EVENT_KEY_DOWN || event.type == SDL_EVENT_KEY_UP) {
+        SDL_Scancode key = event.key.scancode;
+        if ((unsigned)key >= SDL_SCANCODE_COUNT || keyActions[key] == UNBOUND) {
+            anyInputThisFrame |= event.type == SDL_EVENT_KEY_DOWN;
+            return;
+        }
+        Uint32 bits = actionTriggers[keyActions[key]];
+        if (event.type == SDL_EVENT_KEY_DOWN) {
+            anyInputThisFrame = true;
+            setActions(bits, true, timestamp);
+            confirmInputThisFrame |= (bits & mask(Action::Confirm)) != 0;
+        } else {
+            setActions(bits, false, timestamp);
         }
     }
     else if (event.type == SDL_EVENT_FINGER_DOWN ||
              event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
         confirmInputThisFrame = true;
-        setActionState(Action::Jump, true);
+        anyInputThisFrame = true;
+        setActions(mask(Action::Jump), true, timestamp);
     }
     else if (event.type == SDL_EVENT_FINGER_UP ||
              event.type == SDL_EVENT_MOUSE_BUTTON_UP) {
-        setActionState(Action::Jump, false);
+        setActions(mask(Action::Jump), false, timestamp);
+    }
+}
+
+void Input::setActions(Uint32 bits, bool pressed, Uint64 timestamp) {
+    // Only actual transitions are queued: key repeat, or a second key for
+    // an action already held, changes nothing
+    Uint32 changed = pressed ? bits & ~current : bits & current;
+    current = pressed ? current | bits : current & ~bits;
+    LatencyTracker& latency = LatencyTracker::instance();
+    if (devices && pressed && changed && latency.isEnabled()) {
+        latency.inputPolled(timestamp, SDL_GetTicksNS());
+    }
+    while (changed) {
+        int action = SDL_MostSignificantBitIndex32(changed);
+        changed &= ~(1u << action);
+        queueEvent(static_cast<Action>(action), pressed, timestamp);
     }
 }
 
-void Input::setActionState(Action action, bool pressed) {
-    currentState[action] = pressed;
+void Input::queueEvent(Action action, bool pressed, Uint64 timestamp) {
+    if (queueCount == EVENT_QUEUE_SIZE) {
+        // Nobody is consuming (no ticks running); keep the newest
+        queueHead = (queueHead + 1) % EVENT_QUEUE_SIZE;
+        queueCount--;
+    }
+    queue[(queueHead + queueCount) % EVENT_QUEUE_SIZE] = {action, pressed, timestamp};
+    queueCount++;
 }
 
-bool Input::isHeld(Action action) const {
-    auto it = currentState.find(action);
-    return it != currentState.end() && it->second;
+void Input::dropQueued(int i) {
+    // Shift the later entries down over it, keeping time order
+    for (; i + 1 < queueCount; i++) {
+        queue[(queueHead + i) % EVENT_QUEUE_SIZE] = queue[(queueHead + i + 1) % EVENT_QUEUE_SIZE];
+    }
+    queueCount--;
 }
 
-bool Input::justPressed(Action action) const {
-    auto curr = currentState.find(action);
-    auto prev = previousState.find(action);
-    bool currPressed = (curr != currentState.end() && curr->second);
-    bool prevPressed = (prev != previousState.end() && prev->second);
-    return currPressed && !prevPressed;
+void Input::setTickWindow(Uint64 startNs, Uint64 endNs) {
+    tickStart = startNs;
+    tickEnd = endNs;
 }
 
-bool Input::justReleased(Action action) const {
-    auto curr = currentState.find(action);
-    auto prev = previousState.find(action);
-    bool currPressed = (curr != currentState.end() && curr->second);
-    bool prevPressed = (prev != previousState.end() && prev->second);
-    return !currPressed && prevPressed;
+bool Input::consumePress(Action action, float& fraction) {
+    if (replay) {
+        return replayPress(action, fraction);
+    }
+    for (int i = 0; i < queueCount; i++) {
+        const InputEvent& event = getQueuedEvent(i);
+        if (tickEnd != 0 && event.timestamp >= tickEnd) {
+            break;  // Later ticks' events
+        }
+        if (event.action != action || !event.pressed) {
+            continue;
+        }
+        // Quantized to what a recording stores, so replays match exactly
+        Uint16 offset = 0;
+        if (tickEnd > tickStart && event.timestamp > tickStart) {
+            double f = (double)(event.timestamp - tickStart) / (double)(tickEnd - tickStart);
+            offset = (Uint16)SDL_min(65535.0, f * 65536.0);
+        }
+        fraction = offset / 65536.0f;
+        if (recording) {
+            recording->add({tick, InputRecording::Press, static_cast<Uint8>(action), offset});
+        }
+        LatencyTracker& latency = LatencyTracker::instance();
+        if (devices && latency.isEnabled()) {
+            latency.inputConsumed(event.timestamp, SDL_GetTicksNS());
+        }
+        dropQueued(i);
+        return true;
+    }
+    return false;
+}
+
+Uint16 Input::stateBits() const {
+    return static_cast<Uint16>(current |
+                               (confirmInputThisFrame ? InputRecording::STATE_CONFIRM : 0) |
+                               (anyInputThisFrame ? InputRecording::STATE_ANY : 0));
+}
+
+void Input::startRecording(InputRecording* target) {
+    stopReplay();
+    recording = target;
+    recording->reserve(4096);
+    tick = 0;
+    lastRecordedState = 0;
+}
+
+void Input::stopRecording() {
+    if (!recording) {
+        return;
+    }
+    // Mark where the session ended, so a replay holds the last state to here
+    recording->add({tick, InputRecording::State, 0, static_cast<Uint16>(current)});
+    recording = nullptr;
+}
+
+void Input::recordTick() {
+    // The per-tick flags only last one tick, so those are always written
+    const Uint16 flags = InputRecording::STATE_CONFIRM | InputRecording::STATE_ANY;
+    Uint16 state = stateBits();
+    if (state != lastRecordedState || (state & flags)) {
+        recording->add({tick, InputRecording::State, 0, state});
+        lastRecordedState = state;
+    }
+}
+
+void Input::startReplay(const InputRecording* source) {
+    stopRecording();
+    replay = source;
+    tick = 0;
+    replayState = 0;
+    replayPressNext = 0;
+    queueCount = 0;
+    current = 0;
+    previous = 0;
+    SDL_Log("Input: Replaying %d records", (int)replay->size());
+    replayTick();
+}
+
+void Input::stopReplay() {
+    if (!replay) {
+        return;
+    }
+    replay = nullptr;
+    current = 0;
+    confirmInputThisFrame = false;
+    anyInputThisFrame = false;
+}
+
+void Input::replayTick() {
+    const InputRecording& records = *replay;
+    if (tick > records.getLastTick()) {
+        SDL_Log("Input: Replay finished after %u ticks", tick);
+        stopReplay();
+        return;
+    }
+    // Latest state at or before this tick; it holds until the next one
+    for (; replayState < records.size() && records[replayState].tick <= tick; replayState++) {
+        const InputRecord& record = records[replayState];
+        if (record.kind == InputRecording::State) {
+            current = record.value & ~(InputRecording::STATE_CONFIRM | InputRecording::STATE_ANY);
+            confirmInputThisFrame = record.tick == tick && (record.value & InputRecording::STATE_CONFIRM);
+            anyInputThisFrame = record.tick == tick && (record.value & InputRecording::STATE_ANY);
+        }
+    }
+}
+
+bool Input::replayPress(Action action, float& fraction) {
+    const InputRecording& records = *replay;
+    // Presses are consumed in the order they were recorded
+    while (replayPressNext < records.size() &&
+           (records[replayPressNext].kind != InputRecording::Press || records[replayPressNext].tick < tick)) {
+        replayPressNext++;
+    }
+    if (replayPressNext >= records.size()) {
+        return false;
+    }
+    const InputRecord& record = records[replayPressNext];
+    if (record.tick != tick || record.action != static_cast<Uint8>(action)) {
+        return false;
+    }
+    fraction = record.value / 65536.0f;
+    replayPressNext++;
+    return true;
+}
+
+void Input::reset() {
+    recording = nullptr;
+    replay = nullptr;
+    tick = 0;
+    current = 0;
+    previous = 0;
+    confirmInputThisFrame = false;
+    anyInputThisFrame = false;
+    queueHead = 0;
+    queueCount = 0;
+    clearTickWindow();
 }
@@ -1,6 +1,6 @@
 #pragma once
 #include <SDL3/SDL.h>
-#include <unordered_map>
+#include "InputRecording.h"
 
 enum class Action {
     MoveUp,
@@ -13,35 +13,137 @@ enum class Action {
     Jump          // Space, Up, or tap - for platformer
 };
 
+// An action going down or up, stamped with the SDL event time
+// (nanoseconds, SDL_GetTicksNS clock)
+struct InputEvent {
+    Action action;
+    bool pressed;
+    Uint64 timestamp;
+};
+
+// Action state as one bit per Action, so a frame's state is a single word:
+// beginFrame() copies it, and queries are a shift and a mask. Key events
+// look their scancode up in a flat table. Nothing allocates after
+// construction.
+//
+// Each transition is also queued with its timestamp, so the simulation can
+// apply a press at the point inside a tick where it really happened rather
+// than at the tick start. The main loop gives each tick the span of real
+// time it simulates (setTickWindow); presses after the last tick of a frame
+// wait for the tick that covers them.
+//
+// A session can be recorded tick by tick and replayed in place of SDL
+// events. Given the same tick rate the simulation sees exactly the same
+// input on every tick, so the run repeats bit for bit.
+//
+// instance() is the device input of the windowed game. Other instances
+// (see Simulation) are fed only through processEvent() and replays: they
+// don't read the keyboard or report to LatencyTracker, so they can run on
+// any thread.
 class Input {
 public:
+    static constexpr int ACTION_COUNT = static_cast<int>(Action::Jump) + 1;
+    static constexpr int MAX_BOUND_KEYS = 32;
+    static constexpr int EVENT_QUEUE_SIZE = 64;
+
     static Input& instance() {
-        static Input input;
+        static Input input(true);
         return input;
     }
 
-    // Call once per frame before polling events
+    explicit Input(bool devices = false);
+
+    // Call once per frame before polling events (once per tick, after the
+    // update, in the main loop). Drops queued events up to the end of the
+    // tick window, or all of them if no window is set.
     void beginFrame();
 
     // Call for each SDL event
     void processEvent(const SDL_Event& event);
 
     // Query input state
-    bool isHeld(Action action) const;       // Key is currently down
-    bool justPressed(Action action) const;  // Key was pressed this frame
-    bool justReleased(Action action) const; // Key was released this frame
+    bool isHeld(Action action) const { return (current >> bit(action)) & 1u; }
+    bool justPressed(Action action) const { return ((current & ~previous) >> bit(action)) & 1u; }
+    bool justReleased(Action action) const { return ((previous & ~current) >> bit(action)) & 1u; }
 
     // For touch/mouse - returns true if any confirm input this frame
     bool anyConfirmInput() const { return confirmInputThisFrame; }
+    // Any key (bound or not), tap or click this frame ("press any key")
+    bool anyInput() const { return anyInputThisFrame; }
+
+    // Real time simulated by the next update(), in event timestamp units.
+    // Without a window every queued press belongs to the next tick.
+    void setTickWindow(Uint64 startNs, Uint64 endNs);
+    void clearTickWindow() { tickStart = 0; tickEnd = 0; }
+
+    // Take the oldest queued press of the action that falls in the current
+    // tick. fraction is how far into the tick (0..1) it happened; presses
+    // from before the window count as 0.
+    bool consumePress(Action action, float& fraction);
+
+    int getQueuedEventCount() const { return queueCount; }
+    const InputEvent& getQueuedEvent(int i) const { return queue[(queueHead + i) % EVENT_QUEUE_SIZE]; }
+
+    // Record what each tick sees into recording until stopRecording(); the
+    // caller owns it and saves it afterwards
+    void startRecording(InputRecording* recording);
+    void stopRecording();
+    bool isRecording() const { return recording != nullptr; }
+
+    // Feed a recording back instead of events: processEvent() and the
+    // keyboard are ignored until it runs out, then live input resumes
+    void startReplay(const InputRecording* recording);
+    void stopReplay();
+    bool isReplaying() const { return replay != nullptr; }
+
+    // beginFrame() calls since recording or replay started
+    Uint32 getTick() const { return tick; }
+
+    // Release everything (tests, scene resets); stops recording and replay
+    void reset();
 
 private:
-    Input();
+    static constexpr Uint8 UNBOUND = 0xFF;
 
-    std::unordered_map<SDL_Scancode, Action> keyBindings;
-    std::unordered_map<Action, bool> currentState;
-    std::unordered_map<Action, bool> previousState;
-    bool confirmInputThisFrame = false;
+    static int bit(Action action) { return static_cast<int>(action); }
+    static Uint32 mask(Action action) { return 1u << bit(action); }
 
     void bindKey(SDL_Scancode key, Action action);
-    void setActionState(Action action, bool pressed);
+    void setActions(Uint32 bits, bool pressed, Uint64 timestamp);
+    void queueEvent(Action action, bool pressed, Uint64 timestamp);
+    void dropQueued(int i);
+    Uint16 stateBits() const;
+    void recordTick();
+    void replayTick();
+    bool replayPress(Action action, float& fraction);
+
+    bool devices;  // Reads the keyboard and reports latency
+
+    Uint8 keyActions[SDL_SCANCODE_COUNT];  // Scancode -> Action, or UNBOUND
+    SDL_Scancode boundKeys[MAX_BOUND_KEYS];
+    int boundKeyCount = 0;
+
+    // Bits a key event for each action sets or clears; Confirm and MoveUp
+    // keys also drive Jump
+    Uint32 actionTriggers[ACTION_COUNT];
+
+    Uint32 current = 0;
+    Uint32 previous = 0;
+    bool confirmInputThisFrame = false;
+    bool anyInputThisFrame = false;
+
+    InputEvent queue[EVENT_QUEUE_SIZE];
+    int queueHead = 0;
+    int queueCount = 0;
+    Uint64 tickStart = 0;
+    Uint64 tickEnd = 0;
+
+    InputRecording* recording = nullptr;
+    const InputRecording* replay = nullptr;
+    Uint32 tick = 0;
+    Uint16 lastRecordedState = 0;
+    size_t replayState = 0;  // Next State / Press record to play
+    size_t replayPressNext = 0;
+
+    static_assert(ACTION_COUNT <= 14, "Action state must fit in a State record");
 };
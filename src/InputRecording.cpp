@@ -0,0 +1,84 @@
+#include "InputRecording.h"
+#include <cstring>
+#include <fstream>
+
+static constexpr char INPUT_FILE_MAGIC[4] = {'M', 'G', 'I', 'R'};
+static constexpr Uint32 INPUT_FILE_VERSION = 1;
+
+struct InputFileHeader {
+    char magic[4];
+    Uint32 version;
+    float tickRate;
+    Uint32 recordCount;
+};
+
+bool InputRecording::save(const std::string& path) const {
+    static_assert(sizeof(InputRecord) == 8, "InputRecord layout changed");
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("InputRecording: Failed to write file: %s", path.c_str());
+        return false;
+    }
+
+    InputFileHeader header = {};
+    std::memcpy(header.magic, INPUT_FILE_MAGIC, sizeof(header.magic));
+    header.version = INPUT_FILE_VERSION;
+    header.tickRate = tickRate;
+    header.recordCount = static_cast<Uint32>(records.size());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!records.empty()) {
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(InputRecord)));
+    }
+    if (!file) {
+        SDL_Log("InputRecording: Failed to write file: %s", path.c_str());
+        return false;
+    }
+    SDL_Log("InputRecording: Saved %d records (%u ticks) to %s",
+            (int)records.size(), getLastTick(), path.c_str());
+    return true;
+}
+
+bool InputRecording::load(const std::string& path) {
+    records.clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("InputRecording: Failed to open file: %s", path.c_str());
+        return false;
+    }
+
+    InputFileHeader header = {};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        SDL_Log("InputRecording: Truncated file: %s", path.c_str());
+        return false;
+    }
+    if (std::memcmp(header.magic, INPUT_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != INPUT_FILE_VERSION) {
+        SDL_Log("InputRecording: Unsupported file (version %u): %s", header.version, path.c_str());
+        return false;
+    }
+
+    // Don't trust the count further than the file actually goes
+    file.seekg(0, std::ios::end);
+    std::streamoff available = file.tellg() - static_cast<std::streamoff>(sizeof(header));
+    if (available < 0 || (Uint64)available / sizeof(InputRecord) < header.recordCount) {
+        SDL_Log("InputRecording: Truncated file: %s", path.c_str());
+        return false;
+    }
+    file.seekg(sizeof(header));
+
+    records.resize(header.recordCount);
+    if (header.recordCount > 0 &&
+        !file.read(reinterpret_cast<char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(InputRecord)))) {
+        SDL_Log("InputRecording: Truncated file: %s", path.c_str());
+        records.clear();
+        return false;
+    }
+    tickRate = header.tickRate;
+    SDL_Log("InputRecording: Loaded %d records (%u ticks at %.0f Hz) from %s",
+            (int)records.size(), getLastTick(), tickRate, path.c_str());
+    return true;
+}
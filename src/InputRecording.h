@@ -0,0 +1,54 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+// One entry in an input recording. State records hold what the tick saw
+// (InputRecording::STATE_* bits) and are only written when it changes;
+// Press records hold a timestamped press the tick consumed and where in
+// the tick it landed, in 1/65536ths.
+struct InputRecord {
+    Uint32 tick;
+    Uint8 kind;
+    Uint8 action;
+    Uint16 value;
+};
+
+// Action transitions from a play session, keyed by tick index, for
+// replaying it through Input (see Input::startRecording / startReplay).
+//
+// File format (host byte order, like compiled levels):
+//   InputFileHeader
+//   InputRecord records[recordCount]
+class InputRecording {
+public:
+    enum Kind : Uint8 {
+        State = 0,
+        Press = 1,
+    };
+
+    // State record value: action bits, plus the per-tick flags
+    static constexpr Uint16 STATE_CONFIRM = 1u << 14;
+    static constexpr Uint16 STATE_ANY = 1u << 15;
+
+    void clear() { records.clear(); }
+    void add(const InputRecord& record) { records.push_back(record); }
+    void reserve(size_t count) { records.reserve(count); }
+
+    size_t size() const { return records.size(); }
+    bool isEmpty() const { return records.empty(); }
+    const InputRecord& operator[](size_t i) const { return records[i]; }
+    // Tick of the last record, 0 if empty
+    Uint32 getLastTick() const { return records.empty() ? 0 : records.back().tick; }
+
+    // The simulation rate the session ran at; replay must use the same
+    void setTickRate(float hz) { tickRate = hz; }
+    float getTickRate() const { return tickRate; }
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+private:
+    std::vector<InputRecord> records;
+    float tickRate = 60.0f;
+};
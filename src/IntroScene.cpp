@@ -1,10 +1,12 @@
 #include "IntroScene.h"
 #include "LevelIntroScene.h"
+#include "Input.h"
 #include <cmath>
 
 void IntroScene::onEnter() {
     SDL_Log("IntroScene: Enter");
     timer = 0.0f;
+    getScenes().prepare<LevelIntroScene>();
 
     // Initialize orbiting blocks with different colors and breath offsets
     for (int i = 0; i < numBlocks; i++) {
@@ -19,17 +21,15 @@ void IntroScene::onEnter() {
     }
 }
 
-void IntroScene::handleEvent(const SDL_Event& event) {
-    if (event.type == SDL_EVENT_KEY_DOWN ||
-        event.type == SDL_EVENT_FINGER_DOWN ||
-        event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-        requestReplace<LevelIntroScene>(1);
-    }
-}
-
 void IntroScene::update(float deltaTime) {
+    PROFILE_SCOPE("IntroScene::update");
     timer += deltaTime;
 
+    // Any key or tap starts; read through Input so replays drive it too
+    if (getInput().anyInput()) {
+        requestReplace<LevelIntroScene>(1);
+    }
+
     // Update orbit positions and breathing for each block
     const float centerX = 320.0f;
     const float centerY = 120.0f;
@@ -48,6 +48,7 @@ void IntroScene::update(float deltaTime) {
 }
 
 void IntroScene::render(SDL_Renderer* renderer) {
+    PROFILE_SCOPE("IntroScene::render");
     SDL_SetRenderDrawColor(renderer, 20, 20, 60, 255);
     SDL_RenderClear(renderer);
 
@@ -57,23 +58,15 @@ void IntroScene::render(SDL_Renderer* renderer) {
     }
 
     // Draw title (scaled up)
-    SDL_SetRenderScale(renderer, 4.0f, 4.0f);
-    SDL_SetRenderDrawColor(renderer, 255, 255, 100, 255);  // Yellow
-    SDL_RenderDebugText(renderer, 55, 20, "MY GAME");
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    text.addText("MY GAME", 220, 80, 4.0f, 255, 255, 100);  // Yellow
 
     // Draw subtitle
-    SDL_SetRenderScale(renderer, 2.0f, 2.0f);
-    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);  // Light gray
-    SDL_RenderDebugText(renderer, 120, 80, "A Cool Adventure");
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    text.addText("A Cool Adventure", 240, 160, 2.0f, 200, 200, 200);  // Light gray
 
     // Draw "Press any key" with blinking effect
     int blink = (int)(timer * 2) % 2;  // Blink every 0.5 seconds
     if (blink == 0) {
-        SDL_SetRenderScale(renderer, 2.0f, 2.0f);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);  // White
-        SDL_RenderDebugText(renderer, 130, 250, "Press any key");
-        SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+        text.addText("Press any key", 260, 500, 2.0f, 255, 255, 255);  // White
     }
+    text.flush(renderer);
 }
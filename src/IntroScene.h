@@ -1,17 +1,22 @@
 #pragma once
 #include "SceneManager.h"
 #include "Character1.h"
+#include "BitmapFont.h"
 #include <array>
 
 class IntroScene : public Scene {
 public:
+    void reuse() {}  // onEnter() resets everything
+
     void onEnter() override;
-    void handleEvent(const SDL_Event& event) override;
     void update(float deltaTime) override;
     void render(SDL_Renderer* renderer) override;
+    bool isOpaque() const override { return true; }
+    void warmUp(SDL_Renderer* renderer) override { text.prepare(renderer); }
 
 private:
     float timer = 0.0f;
     static constexpr int numBlocks = 6;
     std::array<Character1, numBlocks> orbitBlocks;
+    BitmapFont text;
 };
@@ -0,0 +1,223 @@
+#include "JobSystem.h"
+
+struct Job {
+    std::function<void()> fn;
+    SDL_AtomicInt waitingOn;       // Unfinished dependencies, +1 while submitting
+    SDL_AtomicInt done;
+    SDL_SpinLock lock = 0;         // Guards done (for writers) and next
+    std::vector<JobHandle> next;   // Jobs waiting on this one
+};
+
+namespace {
+// Which system and deque this thread works for; other threads use deque 0
+thread_local const JobSystem* currentSystem = nullptr;
+thread_local int currentWorkerQueue = 0;
+}
+
+JobSystem::JobSystem(int workerCount) {
+    SDL_SetAtomicInt(&sleeping, 0);
+    SDL_SetAtomicInt(&stopping, 0);
+    SDL_SetAtomicInt(&steals, 0);
+    SDL_SetAtomicInt(&pending, 0);
+    queues.resize(1);
+    start(workerCount);
+}
+
+JobSystem::~JobSystem() {
+    stop();
+}
+
+void JobSystem::start(int workerCount) {
+    if (workerCount <= 0 || !workers.empty()) {
+        return;
+    }
+    wake = SDL_CreateSemaphore(0);
+    if (!wake) {
+        SDL_Log("JobSystem: Failed to create semaphore: %s", SDL_GetError());
+        return;
+    }
+    queues.resize(workerCount + 1);
+    workers.reserve(workerCount);  // Threads keep pointers to their Worker
+    for (int i = 0; i < workerCount; i++) {
+        workers.push_back({this, i + 1, nullptr});
+        Worker& worker = workers.back();
+        worker.thread = SDL_CreateThread(workerMain, "JobWorker", &worker);
+        if (!worker.thread) {
+            SDL_Log("JobSystem: Failed to create worker: %s", SDL_GetError());
+            workers.pop_back();
+            break;
+        }
+    }
+    SDL_Log("JobSystem: %d workers", getWorkerCount());
+}
+
+void JobSystem::stop() {
+    if (workers.empty()) {
+        return;
+    }
+    while (SDL_GetAtomicInt(&pending) > 0) {
+        if (!runOne(currentQueue())) {
+            SDL_Delay(0);
+        }
+    }
+    SDL_SetAtomicInt(&stopping, 1);
+    for (size_t i = 0; i < workers.size(); i++) {
+        SDL_SignalSemaphore(wake);
+    }
+    for (Worker& worker : workers) {
+        SDL_WaitThread(worker.thread, nullptr);
+    }
+    workers.clear();
+    queues.resize(1);
+    SDL_DestroySemaphore(wake);
+    wake = nullptr;
+    SDL_SetAtomicInt(&stopping, 0);
+}
+
+JobHandle JobSystem::run(std::function<void()> fn, std::initializer_list<JobHandle> after) {
+    return submit(std::move(fn), after.begin(), after.size());
+}
+
+JobHandle JobSystem::run(std::function<void()> fn, const std::vector<JobHandle>& after) {
+    return submit(std::move(fn), after.data(), after.size());
+}
+
+JobHandle JobSystem::submit(std::function<void()>&& fn, const JobHandle* after, size_t count) {
+    JobHandle job = std::make_shared<Job>();
+    job->fn = std::move(fn);
+    SDL_SetAtomicInt(&job->waitingOn, 1);
+    SDL_SetAtomicInt(&job->done, 0);
+    SDL_AddAtomicInt(&pending, 1);
+
+    for (size_t i = 0; i < count; i++) {
+        Job* dependency = after[i].get();
+        if (!dependency) {
+            continue;
+        }
+        SDL_LockSpinlock(&dependency->lock);
+        if (!SDL_GetAtomicInt(&dependency->done)) {
+            SDL_AddAtomicInt(&job->waitingOn, 1);
+            dependency->next.push_back(job);
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+    }
+
+    // Drop the submitting reference; whoever takes it to zero queues the job
+    if (SDL_AddAtomicInt(&job->waitingOn, -1) == 1) {
+        schedule(job);
+    }
+    return job;
+}
+
+void JobSystem::schedule(JobHandle job) {
+    if (workers.empty()) {
+        execute(job);
+        return;
+    }
+    Queue& queue = queues[currentQueue()];
+    SDL_LockSpinlock(&queue.lock);
+    queue.jobs.push_back(std::move(job));
+    SDL_UnlockSpinlock(&queue.lock);
+    if (SDL_GetAtomicInt(&sleeping) > 0) {
+        SDL_SignalSemaphore(wake);
+    }
+}
+
+void JobSystem::execute(const JobHandle& job) {
+    job->fn();
+    job->fn = nullptr;  // Release what it captured now, not when the last handle goes
+
+    std::vector<JobHandle> ready;
+    SDL_LockSpinlock(&job->lock);
+    SDL_SetAtomicInt(&job->done, 1);
+    ready.swap(job->next);
+    SDL_UnlockSpinlock(&job->lock);
+    for (JobHandle& next : ready) {
+        if (SDL_AddAtomicInt(&next->waitingOn, -1) == 1) {
+            schedule(std::move(next));
+        }
+    }
+    SDL_AddAtomicInt(&pending, -1);
+}
+
+bool JobSystem::runOne(int own) {
+    JobHandle job;
+    // Newest of our own first
+    Queue& mine = queues[own];
+    SDL_LockSpinlock(&mine.lock);
+    if (mine.jobs.size() > mine.head) {
+        job = std::move(mine.jobs.back());
+        mine.jobs.pop_back();
+        if (mine.jobs.size() == mine.head) {
+            mine.jobs.clear();
+            mine.head = 0;
+        }
+    }
+    SDL_UnlockSpinlock(&mine.lock);
+
+    // Then the oldest of anyone else's
+    const int count = static_cast<int>(queues.size());
+    for (int i = 1; !job && i < count; i++) {
+        Queue& victim = queues[(own + i) % count];
+        SDL_LockSpinlock(&victim.lock);
+        if (victim.jobs.size() > victim.head) {
+            job = std::move(victim.jobs[victim.head++]);
+            if (victim.jobs.size() == victim.head) {
+                victim.jobs.clear();
+                victim.head = 0;
+            }
+            SDL_AddAtomicInt(&steals, 1);
+        }
+        SDL_UnlockSpinlock(&victim.lock);
+    }
+
+    if (!job) {
+        return false;
+    }
+    execute(job);
+    return true;
+}
+
+void JobSystem::wait(const JobHandle& job) {
+    if (isDone(job)) {
+        return;
+    }
+    const int own = currentQueue();
+    while (!isDone(job)) {
+        if (!runOne(own)) {
+            SDL_Delay(0);  // Nothing to help with; it's running elsewhere
+        }
+    }
+}
+
+bool JobSystem::isDone(const JobHandle& job) {
+    return !job || SDL_GetAtomicInt(&job->done);
+}
+
+int JobSystem::currentQueue() const {
+    return currentSystem == this ? currentWorkerQueue : 0;
+}
+
+int SDLCALL JobSystem::workerMain(void* data) {
+    Worker& worker = *static_cast<Worker*>(data);
+    JobSystem& system = *worker.system;
+    currentSystem = &system;
+    currentWorkerQueue = worker.queue;
+
+    for (;;) {
+        if (system.runOne(worker.queue)) {
+            continue;
+        }
+        // Announce the nap before the last look, so a job queued in
+        // between either gets seen here or signals the semaphore
+        SDL_AddAtomicInt(&system.sleeping, 1);
+        bool found = system.runOne(worker.queue);
+        if (!found && !SDL_GetAtomicInt(&system.stopping)) {
+            SDL_WaitSemaphore(system.wake);
+        }
+        SDL_AddAtomicInt(&system.sleeping, -1);
+        if (!found && SDL_GetAtomicInt(&system.stopping)) {
+            return 0;
+        }
+    }
+}
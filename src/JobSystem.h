@@ -0,0 +1,89 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+struct Job;
+
+// A submitted job, for waiting on it or running other jobs after it.
+// Null counts as already done.
+using JobHandle = std::shared_ptr<Job>;
+
+// Work-stealing job scheduler on SDL threads. Each worker has a deque: it
+// pushes and pops its own jobs at the back (newest first, still warm in
+// cache) and, when that runs dry, steals the oldest job from the front of
+// another's. Threads that aren't workers (the main thread) share one more
+// deque that the workers steal from.
+//
+// A job can wait for others to finish first; it is queued once the last
+// of them completes. wait() doesn't block idly: the waiting thread runs
+// queued jobs until the one it wants is done, so waiting on the main
+// thread (or inside a job) never leaves a core idle.
+//
+// With no workers every job runs inline as soon as it is ready, on the
+// thread that made it ready. instance() stays that way until start(),
+// so tests, tools and Simulations get plain synchronous behaviour.
+class JobSystem {
+public:
+    static JobSystem& instance() {
+        static JobSystem jobs;
+        return jobs;
+    }
+
+    explicit JobSystem(int workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Start workerCount workers; ignored if some are already running. Call
+    // start() and stop() from the thread that owns the system.
+    void start(int workerCount);
+    // Finish every submitted job (helping from this thread), then join the
+    // workers. Later jobs run inline.
+    void stop();
+
+    // Queue fn to run once every job in after has finished
+    JobHandle run(std::function<void()> fn, std::initializer_list<JobHandle> after = {});
+    JobHandle run(std::function<void()> fn, const std::vector<JobHandle>& after);
+
+    // Run queued jobs on this thread until job is done
+    void wait(const JobHandle& job);
+    static bool isDone(const JobHandle& job);
+
+    int getWorkerCount() const { return static_cast<int>(workers.size()); }
+    Uint64 getStealCount() const { return (Uint64)SDL_GetAtomicInt(&steals); }
+    // Submitted jobs not finished yet, including those waiting on others
+    int getPendingCount() const { return SDL_GetAtomicInt(&pending); }
+
+private:
+    struct Queue {
+        SDL_SpinLock lock = 0;
+        std::vector<JobHandle> jobs;  // Oldest at head; reset when it empties
+        size_t head = 0;
+    };
+
+    struct Worker {
+        JobSystem* system;
+        int queue;
+        SDL_Thread* thread;
+    };
+
+    static int SDLCALL workerMain(void* data);
+
+    JobHandle submit(std::function<void()>&& fn, const JobHandle* after, size_t count);
+    void schedule(JobHandle job);
+    void execute(const JobHandle& job);
+    bool runOne(int queue);
+    int currentQueue() const;
+
+    std::vector<Queue> queues;  // 0 = threads that aren't workers, then one per worker
+    std::vector<Worker> workers;
+    SDL_Semaphore* wake = nullptr;
+    SDL_AtomicInt sleeping;
+    SDL_AtomicInt stopping;
+    mutable SDL_AtomicInt steals;
+    mutable SDL_AtomicInt pending;
+};
@@ -0,0 +1,126 @@
+#include "LatencyTracker.h"
+#include <cstdio>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace {
+    // Clock readings from different threads can be a hair out of order
+    Uint64 elapsed(Uint64 from, Uint64 to) {
+        return to > from ? to - from : 0;
+    }
+}
+
+void LatencyTracker::setEnabled(bool enable) {
+    enabled = enable;
+    pendingCount = 0;
+}
+
+void LatencyTracker::inputPolled(Uint64 eventNs, Uint64 nowNs) {
+    if (!enabled) {
+        return;
+    }
+    // One key can drive several actions; it's still one press
+    for (int i = 0; i < pendingCount; i++) {
+        if (pending[i].eventNs == eventNs) {
+            return;
+        }
+    }
+    if (pendingCount == MAX_PENDING) {
+        removePending(0);
+        dropped++;
+    }
+    pending[pendingCount++] = {eventNs, nowNs, 0};
+}
+
+void LatencyTracker::inputConsumed(Uint64 eventNs, Uint64 nowNs) {
+    if (!enabled) {
+        return;
+    }
+    for (int i = 0; i < pendingCount; i++) {
+        if (pending[i].eventNs == eventNs && pending[i].consumedNs == 0) {
+            pending[i].consumedNs = nowNs;
+            return;
+        }
+    }
+}
+
+void LatencyTracker::framePresented(Uint64 nowNs) {
+    if (!enabled) {
+        return;
+    }
+    int i = 0;
+    while (i < pendingCount) {
+        const Pending& press = pending[i];
+        if (press.consumedNs != 0) {
+            stages[Total].recordNanos(elapsed(press.eventNs, nowNs));
+            stages[Queued].recordNanos(elapsed(press.eventNs, press.polledNs));
+            stages[Waiting].recordNanos(elapsed(press.polledNs, press.consumedNs));
+            stages[Display].recordNanos(elapsed(press.consumedNs, nowNs));
+            removePending(i);
+        } else if (elapsed(press.eventNs, nowNs) > MAX_AGE_NS) {
+            removePending(i);
+            dropped++;
+        } else {
+            i++;
+        }
+    }
+}
+
+void LatencyTracker::removePending(int i) {
+    for (; i + 1 < pendingCount; i++) {
+        pending[i] = pending[i + 1];
+    }
+    pendingCount--;
+}
+
+void LatencyTracker::reset() {
+    for (FrameHistogram& stage : stages) {
+        stage.reset();
+    }
+    pendingCount = 0;
+    dropped = 0;
+}
+
+std::string LatencyTracker::summary() const {
+    const FrameHistogram& total = stages[Total];
+    char text[192];
+    std::snprintf(text, sizeof(text),
+                  "n=%llu p50=%.1f p95=%.1f p99=%.1f max=%.1fms (queued %.1f waiting %.1f display %.1f p50)",
+                  (unsigned long long)total.getCount(), total.getPercentileMs(50.0),
+                  total.getPercentileMs(95.0), total.getPercentileMs(99.0), total.getMaxMs(),
+                  stages[Queued].getPercentileMs(50.0), stages[Waiting].getPercentileMs(50.0),
+                  stages[Display].getPercentileMs(50.0));
+    return text;
+}
+
+std::string LatencyTracker::toJson() const {
+    static const char* const names[STAGE_COUNT] = {"total", "queued", "waiting", "display"};
+    json out = {
+        {"presses", getCount()},
+        {"dropped", dropped},
+    };
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        const FrameHistogram& stage = stages[i];
+        out[names[i]] = {
+            {"meanMs", stage.getMeanMs()},
+            {"p50Ms", stage.getPercentileMs(50.0)},
+            {"p95Ms", stage.getPercentileMs(95.0)},
+            {"p99Ms", stage.getPercentileMs(99.0)},
+            {"maxMs", stage.getMaxMs()},
+        };
+    }
+    return out.dump();
+}
+
+bool LatencyTracker::writeStats(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        SDL_Log("LatencyTracker: Failed to open %s", path.c_str());
+        return false;
+    }
+    file << toJson() << "\n";
+    SDL_Log("LatencyTracker: Input latency: %s", summary().c_str());
+    return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "FrameHistogram.h"
+#include <string>
+
+// Input-to-photon latency of presses the simulation acts on. Each key,
+// finger or mouse press is tagged with its SDL event time when Input sees
+// it; the tick that consumes it (Input::consumePress) stamps it again, and
+// the next SDL_RenderPresent closes it. Presses nothing consumes (menus,
+// key repeat) drop out after MAX_AGE_NS.
+//
+// Every stage is in the SDL_GetTicksNS clock, which is also what event
+// timestamps use. "Present" is when SDL_RenderPresent returns; scan-out
+// adds up to one more refresh on top. Off unless enabled, and then it's a
+// few stores per press.
+class LatencyTracker {
+public:
+    static constexpr int MAX_PENDING = 16;
+    static constexpr Uint64 MAX_AGE_NS = 1000000000;
+
+    // Where the time went, as separate distributions
+    enum Stage {
+        Total,    // Event to present
+        Queued,   // Event to the main loop polling it
+        Waiting,  // Poll to the tick that consumed it
+        Display,  // Consuming tick to present
+        STAGE_COUNT
+    };
+
+    static LatencyTracker& instance() {
+        static LatencyTracker tracker;
+        return tracker;
+    }
+
+    void setEnabled(bool enable);
+    bool isEnabled() const { return enabled; }
+
+    // A press event seen by Input (eventNs is the event's timestamp)
+    void inputPolled(Uint64 eventNs, Uint64 nowNs);
+    // The simulation acted on the press with that timestamp
+    void inputConsumed(Uint64 eventNs, Uint64 nowNs);
+    // A frame was presented; closes every consumed press
+    void framePresented(Uint64 nowNs);
+
+    const FrameHistogram& getHistogram(Stage stage) const { return stages[stage]; }
+    Uint64 getCount() const { return stages[Total].getCount(); }
+    Uint64 getDropped() const { return dropped; }
+    int getPendingCount() const { return pendingCount; }
+    void reset();
+
+    // "n=12 p50=41.2 p95=52.0 p99=55.1 max=55.1ms (queued 4.1 waiting 0.1 display 33.6 p50)"
+    std::string summary() const;
+    std::string toJson() const;
+    bool writeStats(const std::string& path) const;
+
+private:
+    LatencyTracker() = default;
+
+    struct Pending {
+        Uint64 eventNs;
+        Uint64 polledNs;
+        Uint64 consumedNs;  // 0 until a tick uses it
+    };
+
+    void removePending(int i);
+
+    bool enabled = false;
+    Pending pending[MAX_PENDING] = {};
+    int pendingCount = 0;
+    Uint64 dropped = 0;
+    FrameHistogram stages[STAGE_COUNT];
+};
@@ -1,11 +1,127 @@
 #include "Level.h"
+#include "MappedFile.h"
+#include "SimdOverlap.h"
 #include <nlohmann/json.hpp>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <SDL3/SDL.h>
 
 using json = nlohmann::json;
 
+// Compiled level layout (".lvlb"). Little-endian, every section padded to
+// 4 bytes so arrays can be used in place from the mapping:
+//   LevelFileHeader
+//   char          name[nameLength]
+//   GroundSegment ground[groundCount]
+//   Platform      platforms[platformCount]
+//   TreasureRecord treasures[treasureCount]
+//   Obstacle      obstacles[obstacleCount]
+//   GroundSegment groundIndex[groundIndexCount]
+//   PlatformEntry platformIndex[platformCount]
+//   XEntry        obstacleIndex[obstacleCount]
+//   XEntry        treasureIndex[treasureCount]
+static constexpr char LEVEL_FILE_MAGIC[4] = {'L', 'V', 'L', 'B'};
+static constexpr uint32_t LEVEL_FILE_VERSION = 1;
+
+struct LevelFileHeader {
+    char magic[4];
+    uint32_t version;
+    float length;
+    float groundY;
+    float maxPlatformWidth;
+    float maxObstacleWidth;
+    uint32_t nameLength;
+    uint32_t groundCount;
+    uint32_t platformCount;
+    uint32_t treasureCount;
+    uint32_t obstacleCount;
+    uint32_t groundIndexCount;
+};
+
+// Treasure without the runtime collected flag
+struct TreasureRecord {
+    float x;
+    float y;
+    int32_t points;
+};
+
+static_assert(sizeof(LevelFileHeader) == 48, "LevelFileHeader layout changed");
+static_assert(sizeof(GroundSegment) == 8, "GroundSegment layout changed");
+static_assert(sizeof(Platform) == 16, "Platform layout changed");
+static_assert(sizeof(Obstacle) == 16, "Obstacle layout changed");
+static_assert(sizeof(TreasureRecord) == 12, "TreasureRecord layout changed");
+
+static size_t align4(size_t n) {
+    return (n + 3) & ~static_cast<size_t>(3);
+}
+
+Level::Level() = default;
+Level::~Level() = default;
+Level::Level(Level&&) noexcept = default;
+Level& Level::operator=(Level&&) noexcept = default;
+
+// Parse the entity arrays shared by whole-level files and chunk files
+static void parseEntities(const json& data,
+                          std::vector<GroundSegment>& ground,
+                          std::vector<Platform>& platforms,
+                          std::vector<Treasure>& treasures,
+                          std::vector<Obstacle>& obstacles) {
+    // Parse ground segments
+    if (data.contains("ground")) {
+        for (const auto& seg : data["ground"]) {
+            GroundSegment gs;
+            gs.startX = seg.value("start", 0.0f);
+            gs.endX = seg.value("end", 0.0f);
+            ground.push_back(gs);
+        }
+    }
+
+    // Parse platforms
+    if (data.contains("platforms")) {
+        for (const auto& plat : data["platforms"]) {
+            Platform p;
+            p.x = plat.value("x", 0.0f);
+            p.y = plat.value("y", 0.0f);
+            p.width = plat.value("width", 100.0f);
+            p.height = plat.value("height", 20.0f);
+            platforms.push_back(p);
+        }
+    }
+
+    // Parse treasures
+    if (data.contains("treasures")) {
+        for (const auto& t : data["treasures"]) {
+            Treasure tr;
+            tr.x = t.value("x", 0.0f);
+            tr.y = t.value("y", 0.0f);
+            tr.points = t.value("points", 100);
+            tr.collected = false;
+            treasures.push_back(tr);
+        }
+    }
+
+    // Parse obstacles
+    if (data.contains("obstacles")) {
+        for (const auto& o : data["obstacles"]) {
+            Obstacle obs;
+            obs.x = o.value("x", 0.0f);
+            obs.y = o.value("y", 0.0f);
+            obs.width = o.value("width", 30.0f);
+            obs.height = o.value("height", 40.0f);
+            obstacles.push_back(obs);
+        }
+    }
+}
+
 bool Level::loadFromFile(const std::string& path) {
+    const std::string binaryExt = ".lvlb";
+    if (path.size() >= binaryExt.size() &&
+        path.compare(path.size() - binaryExt.size(), binaryExt.size(), binaryExt) == 0) {
+        return loadBinary(path);
+    }
+
     std::ifstream file(path);
     if (!file.is_open()) {
         SDL_Log("Level: Failed to open file: %s", path.c_str());
@@ -15,63 +131,52 @@ bool Level::loadFromFile(const std::string& path) {
     try {
         json data = json::parse(file);
 
+        // Chunked level: this file is only a manifest, entities stream in.
+        // Check its layout before replacing the level already loaded.
+        bool manifest = data.contains("chunkCount");
+        float manifestChunkWidth = data.value("chunkWidth", 2000.0f);
+        int manifestChunkCount = data.value("chunkCount", 0);
+        if (manifest && (manifestChunkWidth <= 0.0f || manifestChunkCount <= 0)) {
+            SDL_Log("Level: Invalid chunk layout in %s", path.c_str());
+            return false;
+        }
+
         name = data.value("name", "Unnamed Level");
         length = data.value("length", 2000.0f);
         groundY = data.value("groundY", 500.0f);
 
-        // Parse ground segments
         ground.clear();
-        if (data.contains("ground")) {
-            for (const auto& seg : data["ground"]) {
-                GroundSegment gs;
-                gs.startX = seg.value("start", 0.0f);
-                gs.endX = seg.value("end", 0.0f);
-                ground.push_back(gs);
-            }
-        }
-
-        // Parse platforms
         platforms.clear();
-        if (data.contains("platforms")) {
-            for (const auto& plat : data["platforms"]) {
-                Platform p;
-                p.x = plat.value("x", 0.0f);
-                p.y = plat.value("y", 0.0f);
-                p.width = plat.value("width", 100.0f);
-                p.height = plat.value("height", 20.0f);
-                platforms.push_back(p);
-            }
-        }
-
-        // Parse treasures
         treasures.clear();
-        if (data.contains("treasures")) {
-            for (const auto& t : data["treasures"]) {
-                Treasure tr;
-                tr.x = t.value("x", 0.0f);
-                tr.y = t.value("y", 0.0f);
-                tr.points = t.value("points", 100);
-                tr.collected = false;
-                treasures.push_back(tr);
-            }
-        }
-
-        // Parse obstacles
         obstacles.clear();
-        if (data.contains("obstacles")) {
-            for (const auto& o : data["obstacles"]) {
-                Obstacle obs;
-                obs.x = o.value("x", 0.0f);
-                obs.y = o.value("y", 0.0f);
-                obs.width = o.value("width", 30.0f);
-                obs.height = o.value("height", 40.0f);
-                obstacles.push_back(obs);
-            }
+        residentChunks.clear();
+        missingChunks = false;
+        dropPrefetch();
+        mappedFile.reset();
+
+        streaming = manifest;
+        if (streaming) {
+            chunkWidth = manifestChunkWidth;
+            chunkCount = manifestChunkCount;
+            size_t slash = path.find_last_of("/\\");
+            std::string dir = (slash == std::string::npos) ? "" : path.substr(0, slash + 1);
+            chunkPathPrefix = dir + data.value("chunkPrefix", "");
+            initialTreasures.clear();
+
+            buildIndex();
+
+            SDL_Log("Level: Loaded '%s' - length: %.0f, streaming %d chunks of %.0f",
+                    name.c_str(), length, chunkCount, chunkWidth);
+            return true;
         }
 
+        parseEntities(data, ground, platforms, treasures, obstacles);
+
         // Store initial state for reset
         initialTreasures = treasures;
 
+        buildIndex();
+
         SDL_Log("Level: Loaded '%s' - length: %.0f, ground segments: %zu, platforms: %zu, treasures: %zu, obstacles: %zu",
                 name.c_str(), length, ground.size(), platforms.size(), treasures.size(), obstacles.size());
 
@@ -79,17 +184,466 @@ bool Level::loadFromFile(const std::string& path) {
     }
     catch (const json::exception& e) {
         SDL_Log("Level: JSON parse error: %s", e.what());
+        // Don't leave views pointing at a released mapping or half-parsed data
+        if (!mappedFile) {
+            streaming = false;
+            ground.clear();
+            platforms.clear();
+            treasures.clear();
+            obstacles.clear();
+            initialTreasures.clear();
+            buildIndex();
+        }
         return false;
     }
 }
 
-bool Level::hasGroundAt(float worldX) const {
+int Level::chunkIndexAt(float worldX) const {
+    int index = static_cast<int>(std::floor(worldX / chunkWidth));
+    return std::clamp(index, 0, chunkCount - 1);
+}
+
+bool Level::loadChunk(const std::string& pathPrefix, int index, Chunk& chunk) {
+    chunk.index = index;
+    std::string path = pathPrefix + std::to_string(index) + ".json";
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        SDL_Log("Level: Failed to open chunk: %s", path.c_str());
+        return false;
+    }
+
+    try {
+        json data = json::parse(file);
+        parseEntities(data, chunk.ground, chunk.platforms, chunk.treasures, chunk.obstacles);
+        return true;
+    }
+    catch (const json::exception& e) {
+        SDL_Log("Level: JSON parse error in chunk %d: %s", index, e.what());
+        return false;
+    }
+}
+
+void Level::setJobSystem(JobSystem* jobSystem) {
+    if (jobSystem == jobs) {
+        return;
+    }
+    dropPrefetch();
+    jobs = jobSystem;
+    if (!residentChunks.empty()) {
+        prefetchChunk(residentChunks.back().index + 1);
+    }
+}
+
+bool Level::takeChunk(int index, Chunk& chunk) {
+    if (prefetched && prefetchedIndex == index) {
+        jobs->wait(prefetchJob);  // Usually finished long ago
+        chunk = std::move(prefetched->chunk);
+        bool loaded = prefetched->loaded;
+        dropPrefetch();
+        return loaded;
+    }
+    return loadChunk(chunkPathPrefix, index, chunk);
+}
+
+void Level::prefetchChunk(int index) {
+    if (!jobs || index >= chunkCount || prefetchedIndex == index) {
+        return;
+    }
+    // A prefetch for another chunk (the view jumped) is left to finish
+    // unused
+    auto target = std::make_shared<Prefetch>();
+    std::string prefix = chunkPathPrefix;
+    prefetchJob = jobs->run([target, prefix, index] {
+        target->loaded = loadChunk(prefix, index, target->chunk);
+    });
+    prefetched = std::move(target);
+    prefetchedIndex = index;
+}
+
+void Level::dropPrefetch() {
+    prefetchJob.reset();
+    prefetched.reset();
+    prefetchedIndex = -1;
+}
+
+void Level::streamTo(float viewMinX, float viewMaxX) {
+    if (!streaming) {
+        return;
+    }
+
+    // Keep one chunk behind the view (for entities that straddle a boundary)
+    // and one ahead of it (so the next chunk is resident before it is visible)
+    int first = std::max(0, chunkIndexAt(viewMinX) - 1);
+    int last = std::min(chunkCount - 1, chunkIndexAt(viewMaxX) + 1);
+
+    bool upToDate = !residentChunks.empty() &&
+                    residentChunks.front().index == first &&
+                    residentChunks.back().index == last;
+    if (upToDate) {
+        return;
+    }
+
+    // Collected state lives in the bitset over the flat treasure list; copy
+    // it back to the chunks first
+    size_t t = 0;
+    for (auto& chunk : residentChunks) {
+        for (auto& treasure : chunk.treasures) {
+            treasure.collected = isTreasureCollected(t++);
+        }
+    }
+
+    // Evict chunks outside [first, last], load missing ones
+    std::vector<Chunk> next;
+    next.reserve(last - first + 1);
+    for (int i = first; i <= last; i++) {
+        auto it = std::find_if(residentChunks.begin(), residentChunks.end(),
+            [i](const Chunk& c) { return c.index == i; });
+        if (it != residentChunks.end()) {
+            next.push_back(std::move(*it));
+        } else {
+            Chunk chunk;
+            if (!takeChunk(i, chunk)) {
+                SDL_Log("Level: Chunk %d of %s is missing; the level has a gap there", i, name.c_str());
+                missingChunks = true;
+            }
+            next.push_back(std::move(chunk));
+        }
+    }
+    residentChunks = std::move(next);
+
+    // Rebuild the flat entity lists from resident chunks
+    ground.clear();
+    platforms.clear();
+    treasures.clear();
+    obstacles.clear();
+    for (const auto& chunk : residentChunks) {
+        ground.insert(ground.end(), chunk.ground.begin(), chunk.ground.end());
+        platforms.insert(platforms.end(), chunk.platforms.begin(), chunk.platforms.end());
+        treasures.insert(treasures.end(), chunk.treasures.begin(), chunk.treasures.end());
+        obstacles.insert(obstacles.end(), chunk.obstacles.begin(), chunk.obstacles.end());
+    }
+
+    buildIndex();
+
+    // The view moves forward, so the next chunk it reaches is the one past
+    // the resident ones
+    prefetchChunk(last + 1);
+}
+
+void Level::buildIndex() {
+    // Ground: sort by start and merge touching/overlapping segments
+    std::vector<GroundSegment> sorted;
+    sorted.reserve(ground.size());
     for (const auto& seg : ground) {
-        if (worldX >= seg.startX && worldX <= seg.endX) {
-            return true;
+        if (seg.endX >= seg.startX) {  // Inverted segments never contain a point
+            sorted.push_back(seg);
+        }
+    }
+    std::sort(sorted.begin(), sorted.end(),
+        [](const GroundSegment& a, const GroundSegment& b) { return a.startX < b.startX; });
+
+    groundIndex.clear();
+    for (const auto& seg : sorted) {
+        if (!groundIndex.empty() && seg.startX <= groundIndex.back().endX) {
+            groundIndex.back().endX = std::max(groundIndex.back().endX, seg.endX);
+        } else {
+            groundIndex.push_back(seg);
         }
     }
-    return false;
+
+    // Platforms: sort by left edge, remember the widest for the search window
+    platformIndex.clear();
+    platformIndex.reserve(platforms.size());
+    maxPlatformWidth = 0.0f;
+    for (size_t i = 0; i < platforms.size(); i++) {
+        const Platform& p = platforms[i];
+        platformIndex.push_back({p.x, p.x + p.width, p.y, static_cast<uint32_t>(i)});
+        maxPlatformWidth = std::max(maxPlatformWidth, p.width);
+    }
+    std::sort(platformIndex.begin(), platformIndex.end(),
+        [](const PlatformEntry& a, const PlatformEntry& b) { return a.x < b.x; });
+
+    // Obstacles and treasures: sort by x for the collision broadphase
+    auto byX = [](const XEntry& a, const XEntry& b) { return a.x < b.x; };
+
+    obstacleIndex.clear();
+    obstacleIndex.reserve(obstacles.size());
+    maxObstacleWidth = 0.0f;
+    for (size_t i = 0; i < obstacles.size(); i++) {
+        obstacleIndex.push_back({obstacles[i].x, static_cast<uint32_t>(i)});
+        maxObstacleWidth = std::max(maxObstacleWidth, obstacles[i].width);
+    }
+    std::stable_sort(obstacleIndex.begin(), obstacleIndex.end(), byX);
+
+    treasureIndex.clear();
+    treasureIndex.reserve(treasures.size());
+    for (size_t i = 0; i < treasures.size(); i++) {
+        treasureIndex.push_back({treasures[i].x, static_cast<uint32_t>(i)});
+    }
+    std::stable_sort(treasureIndex.begin(), treasureIndex.end(), byX);
+
+    useOwnedStorage();
+    buildEntityArrays();
+    revision++;
+}
+
+void Level::buildEntityArrays() {
+    // Clear without giving up capacity; streamed levels rebuild often
+    auto clearRects = [](RectArrays& r) {
+        r.x.clear(); r.y.clear(); r.w.clear(); r.h.clear(); r.id.clear();
+    };
+
+    clearRects(platformArrays);
+    for (const auto& entry : platformIndexView) {
+        const Platform& p = platformsView[entry.order];
+        platformArrays.x.push_back(p.x);
+        platformArrays.y.push_back(p.y);
+        platformArrays.w.push_back(p.width);
+        platformArrays.h.push_back(p.height);
+        platformArrays.id.push_back(entry.order);
+    }
+
+    clearRects(obstacleArrays);
+    for (const auto& entry : obstacleIndexView) {
+        const Obstacle& o = obstaclesView[entry.index];
+        obstacleArrays.x.push_back(o.x);
+        obstacleArrays.y.push_back(o.y);
+        obstacleArrays.w.push_back(o.width);
+        obstacleArrays.h.push_back(o.height);
+        obstacleArrays.id.push_back(entry.index);
+    }
+
+    treasureArrays.x.clear();
+    treasureArrays.y.clear();
+    treasureArrays.id.clear();
+    treasureSlot.assign(treasures.size(), 0);
+    treasureCollected.assign((treasureIndexView.size() + 63) / 64, 0);
+    for (const auto& entry : treasureIndexView) {
+        const Treasure& t = treasures[entry.index];
+        uint32_t slot = static_cast<uint32_t>(treasureArrays.x.size());
+        treasureArrays.x.push_back(t.x);
+        treasureArrays.y.push_back(t.y);
+        treasureArrays.id.push_back(entry.index);
+        treasureSlot[entry.index] = slot;
+        if (t.collected) {
+            treasureCollected[slot >> 6] |= uint64_t(1) << (slot & 63);
+        }
+    }
+}
+
+void Level::useOwnedStorage() {
+    groundView = ground;
+    platformsView = platforms;
+    obstaclesView = obstacles;
+    groundIndexView = groundIndex;
+    platformIndexView = platformIndex;
+    obstacleIndexView = obstacleIndex;
+    treasureIndexView = treasureIndex;
+}
+
+bool Level::saveBinary(const std::string& path) const {
+    static_assert(sizeof(PlatformEntry) == 16, "PlatformEntry layout changed");
+    static_assert(sizeof(XEntry) == 8, "XEntry layout changed");
+
+    if (streaming) {
+        SDL_Log("Level: Can't compile a streamed level: %s", path.c_str());
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("Level: Failed to write file: %s", path.c_str());
+        return false;
+    }
+
+    LevelFileHeader header = {};
+    std::memcpy(header.magic, LEVEL_FILE_MAGIC, sizeof(header.magic));
+    header.version = LEVEL_FILE_VERSION;
+    header.length = length;
+    header.groundY = groundY;
+    header.maxPlatformWidth = maxPlatformWidth;
+    header.maxObstacleWidth = maxObstacleWidth;
+    header.nameLength = static_cast<uint32_t>(name.size());
+    header.groundCount = static_cast<uint32_t>(groundView.size());
+    header.platformCount = static_cast<uint32_t>(platformsView.size());
+    header.treasureCount = static_cast<uint32_t>(initialTreasures.size());
+    header.obstacleCount = static_cast<uint32_t>(obstaclesView.size());
+    header.groundIndexCount = static_cast<uint32_t>(groundIndexView.size());
+
+    auto writeSection = [&file](const void* data, size_t bytes) {
+        static const char padding[4] = {};
+        if (bytes > 0) {
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        }
+        file.write(padding, static_cast<std::streamsize>(align4(bytes) - bytes));
+    };
+
+    std::vector<TreasureRecord> records;
+    records.reserve(initialTreasures.size());
+    for (const auto& t : initialTreasures) {
+        records.push_back({t.x, t.y, t.points});
+    }
+
+    writeSection(&header, sizeof(header));
+    writeSection(name.data(), name.size());
+    writeSection(groundView.data(), groundView.size() * sizeof(GroundSegment));
+    writeSection(platformsView.data(), platformsView.size() * sizeof(Platform));
+    writeSection(records.data(), records.size() * sizeof(TreasureRecord));
+    writeSection(obstaclesView.data(), obstaclesView.size() * sizeof(Obstacle));
+    writeSection(groundIndexView.data(), groundIndexView.size() * sizeof(GroundSegment));
+    writeSection(platformIndexView.data(), platformIndexView.size() * sizeof(PlatformEntry));
+    writeSection(obstacleIndexView.data(), obstacleIndexView.size() * sizeof(XEntry));
+    writeSection(treasureIndexView.data(), treasureIndexView.size() * sizeof(XEntry));
+
+    return static_cast<bool>(file);
+}
+
+bool Level::loadBinary(const std::string& path) {
+    auto file = std::make_unique<MappedFile>();
+    if (!file->open(path)) {
+        SDL_Log("Level: Failed to open file: %s", path.c_str());
+        return false;
+    }
+
+    const unsigned char* data = file->data();
+    const size_t size = file->size();
+
+    LevelFileHeader header;
+    if (size < sizeof(header)) {
+        SDL_Log("Level: Truncated level file: %s", path.c_str());
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, LEVEL_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != LEVEL_FILE_VERSION) {
+        SDL_Log("Level: Unsupported level file (version %u): %s", header.version, path.c_str());
+        return false;
+    }
+
+    // Walk the sections, checking each fits in the file
+    size_t offset = sizeof(header);
+    bool ok = true;
+    auto section = [&](size_t count, size_t elementSize) -> const void* {
+        if (!ok || count > (size - offset) / elementSize) {
+            ok = false;
+            return nullptr;
+        }
+        const void* p = data + offset;
+        offset = std::min(size, offset + align4(count * elementSize));
+        return p;
+    };
+
+    auto nameBytes = static_cast<const char*>(section(header.nameLength, 1));
+    auto groundData = static_cast<const GroundSegment*>(section(header.groundCount, sizeof(GroundSegment)));
+    auto platformData = static_cast<const Platform*>(section(header.platformCount, sizeof(Platform)));
+    auto treasureData = static_cast<const TreasureRecord*>(section(header.treasureCount, sizeof(TreasureRecord)));
+    auto obstacleData = static_cast<const Obstacle*>(section(header.obstacleCount, sizeof(Obstacle)));
+    auto groundIndexData = static_cast<const GroundSegment*>(section(header.groundIndexCount, sizeof(GroundSegment)));
+    auto platformIndexData = static_cast<const PlatformEntry*>(section(header.platformCount, sizeof(PlatformEntry)));
+    auto obstacleIndexData = static_cast<const XEntry*>(section(header.obstacleCount, sizeof(XEntry)));
+    auto treasureIndexData = static_cast<const XEntry*>(section(header.treasureCount, sizeof(XEntry)));
+    if (!ok) {
+        SDL_Log("Level: Truncated level file: %s", path.c_str());
+        return false;
+    }
+
+    // Queries trust the index sections without bounds checks, so a corrupt
+    // or hand-edited file must not get past here: each index has to name
+    // every entity exactly once, in ascending x, and agree with it
+    std::vector<bool> seen;
+    auto validIndex = [&seen](const auto* entries, uint32_t count, auto entityField, auto&& matches) {
+        seen.assign(count, false);
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t entity = entries[i].*entityField;
+            if (entity >= count || seen[entity] || !matches(entries[i], entity) ||
+                (i > 0 && !(entries[i - 1].x <= entries[i].x))) {
+                return false;
+            }
+            seen[entity] = true;
+        }
+        return true;
+    };
+    ok = validIndex(platformIndexData, header.platformCount, &PlatformEntry::order,
+        [&](const PlatformEntry& e, uint32_t i) {
+            const Platform& p = platformData[i];
+            return e.x == p.x && e.right == p.x + p.width && e.y == p.y && p.width <= header.maxPlatformWidth;
+        }) &&
+        validIndex(obstacleIndexData, header.obstacleCount, &XEntry::index,
+        [&](const XEntry& e, uint32_t i) {
+            return e.x == obstacleData[i].x && obstacleData[i].width <= header.maxObstacleWidth;
+        }) &&
+        validIndex(treasureIndexData, header.treasureCount, &XEntry::index,
+        [&](const XEntry& e, uint32_t i) { return e.x == treasureData[i].x; });
+    // Ground intervals sorted and merged (hasGroundAt binary searches them)
+    for (uint32_t i = 0; ok && i < header.groundIndexCount; i++) {
+        const GroundSegment& seg = groundIndexData[i];
+        ok = seg.startX <= seg.endX && (i == 0 || groundIndexData[i - 1].endX < seg.startX);
+    }
+    if (!ok) {
+        SDL_Log("Level: Corrupt index in level file: %s", path.c_str());
+        return false;
+    }
+
+    // Everything except treasures (which carry mutable collected state) is
+    // used in place from the mapping
+    name.assign(nameBytes, header.nameLength);
+    length = header.length;
+    groundY = header.groundY;
+    maxPlatformWidth = header.maxPlatformWidth;
+    maxObstacleWidth = header.maxObstacleWidth;
+    streaming = false;
+    residentChunks.clear();
+    missingChunks = false;
+    dropPrefetch();
+
+    ground.clear();
+    platforms.clear();
+    obstacles.clear();
+    groundIndex.clear();
+    platformIndex.clear();
+    obstacleIndex.clear();
+    treasureIndex.clear();
+
+    treasures.resize(header.treasureCount);
+    for (uint32_t i = 0; i < header.treasureCount; i++) {
+        treasures[i] = {treasureData[i].x, treasureData[i].y, treasureData[i].points, false};
+    }
+    initialTreasures = treasures;
+
+    groundView = {groundData, header.groundCount};
+    platformsView = {platformData, header.platformCount};
+    obstaclesView = {obstacleData, header.obstacleCount};
+    groundIndexView = {groundIndexData, header.groundIndexCount};
+    platformIndexView = {platformIndexData, header.platformCount};
+    obstacleIndexView = {obstacleIndexData, header.obstacleCount};
+    treasureIndexView = {treasureIndexData, header.treasureCount};
+    mappedFile = std::move(file);
+    buildEntityArrays();
+    revision++;
+
+    SDL_Log("Level: Loaded '%s' (compiled) - length: %.0f, ground segments: %zu, platforms: %zu, treasures: %zu, obstacles: %zu",
+            name.c_str(), length, groundView.size(), platformsView.size(), treasures.size(), obstaclesView.size());
+    return true;
+}
+
+bool Level::hasGroundAt(float worldX) const {
+    // Last interval starting at or before worldX
+    auto it = std::upper_bound(groundIndexView.begin(), groundIndexView.end(), worldX,
+        [](float x, const GroundSegment& seg) { return x < seg.startX; });
+    if (it == groundIndexView.begin()) {
+        return false;
+    }
+    --it;
+    return worldX <= it->endX;
+}
+
+ArrayView<const GroundSegment> Level::findGroundInSpan(float minX, float maxX) const {
+    // Intervals are sorted and disjoint, so their ends ascend too
+    auto first = std::upper_bound(groundIndexView.begin(), groundIndexView.end(), minX,
+        [](float x, const GroundSegment& seg) { return x < seg.endX; });
+    auto last = std::lower_bound(first, groundIndexView.end(), maxX,
+        [](const GroundSegment& seg, float x) { return seg.startX < x; });
+    return {first, static_cast<size_t>(last - first)};
 }
 
 float Level::getPlatformSurfaceAt(float worldX, float playerBottomY, float velocityY) const {
@@ -98,19 +652,116 @@ float Level::getPlatformSurfaceAt(float worldX, float playerBottomY, float veloc
         return -1.0f;  // Going up, don't land
     }
 
-    for (const auto& plat : platforms) {
-        // Check horizontal overlap
-        if (worldX >= plat.x && worldX <= plat.x + plat.width) {
-            // Check if player is near platform top (within landing tolerance)
-            float landingTolerance = 15.0f;  // Pixels of tolerance for landing
-            if (playerBottomY >= plat.y && playerBottomY <= plat.y + landingTolerance) {
-                return plat.y;
+    // Only platforms starting within maxPlatformWidth to the left can reach
+    // worldX (1px slack covers float rounding of x + width)
+    float searchStart = worldX - maxPlatformWidth - 1.0f;
+    auto it = std::lower_bound(platformIndexView.begin(), platformIndexView.end(), searchStart,
+        [](const PlatformEntry& p, float x) { return p.x < x; });
+
+    const float landingTolerance = 15.0f;  // Pixels of tolerance for landing
+    const PlatformEntry* best = nullptr;
+    for (; it != platformIndexView.end() && it->x <= worldX; ++it) {
+        // Check horizontal overlap and if player is near platform top
+        if (worldX >= it->x && worldX <= it->right &&
+            playerBottomY >= it->y && playerBottomY <= it->y + landingTolerance) {
+            if (!best || it->order < best->order) {
+                best = it;
             }
         }
     }
-    return -1.0f;
+    return best ? best->y : -1.0f;
 }
 
 void Level::reset() {
+    if (streaming) {
+        // Drop everything; chunks reload from disk (uncollected) on the next
+        // streamTo(), and the camera only moves forward within a run. A
+        // prefetched chunk was never played, so it stays usable.
+        residentChunks.clear();
+        missingChunks = false;
+        ground.clear();
+        platforms.clear();
+        treasures.clear();
+        obstacles.clear();
+        buildIndex();
+        return;
+    }
     treasures = initialTreasures;
+    std::fill(treasureCollected.begin(), treasureCollected.end(), 0);
+}
+
+void Level::findRects(const RectArrays& rects, float searchStart,
+                      float minX, float minY, float maxX, float maxY,
+                      std::vector<uint32_t>& out) {
+    // Rects are sorted by x: skip those starting too far left to reach minX
+    // and stop at the first starting at or past maxX
+    const float* xs = rects.x.data();
+    const float* end = xs + rects.x.size();
+    size_t first = std::lower_bound(xs, end, searchStart) - xs;
+    size_t last = std::lower_bound(xs + first, end, maxX) - xs;
+
+    out.resize(last - first);
+    size_t n = findRectsOverlapping(xs, rects.y.data(), rects.w.data(), rects.h.data(),
+                                    first, last, minX, minY, maxX, maxY, out.data());
+    for (size_t i = 0; i < n; i++) {
+        out[i] = rects.id[out[i]];
+    }
+    out.resize(n);
+}
+
+void Level::findObstaclesOverlapping(float minX, float minY, float maxX, float maxY,
+                                     std::vector<uint32_t>& out) const {
+    // 1px slack covers float rounding of x + width
+    findRects(obstacleArrays, minX - maxObstacleWidth - 1.0f, minX, minY, maxX, maxY, out);
+}
+
+void Level::findPlatformsOverlapping(float minX, float minY, float maxX, float maxY,
+                                     std::vector<uint32_t>& out) const {
+    findRects(platformArrays, minX - maxPlatformWidth - 1.0f, minX, minY, maxX, maxY, out);
+}
+
+void Level::findTreasuresInRadius(float x, float y, float radius, std::vector<uint32_t>& out) const {
+    const float* xs = treasureArrays.x.data();
+    const float* end = xs + treasureArrays.x.size();
+    size_t first = std::lower_bound(xs, end, x - radius - 1.0f) - xs;
+    size_t last = std::upper_bound(xs + first, end, x + radius + 1.0f) - xs;
+
+    out.resize(last - first);
+    size_t n = findPointsInCircle(xs, treasureArrays.y.data(), treasureCollected.data(),
+                                  first, last, x, y, radius * radius, out.data());
+    for (size_t i = 0; i < n; i++) {
+        out[i] = treasureArrays.id[out[i]];
+    }
+    out.resize(n);
+}
+
+void Level::findTreasuresInSpan(float minX, float maxX, std::vector<uint32_t>& out) const {
+    const float* xs = treasureArrays.x.data();
+    const float* end = xs + treasureArrays.x.size();
+    size_t first = std::upper_bound(xs, end, minX) - xs;
+    size_t last = std::lower_bound(xs + first, end, maxX) - xs;
+
+    out.resize(last - first);
+    size_t n = findPointsInSpan(xs, treasureCollected.data(), first, last, minX, maxX, out.data());
+    for (size_t i = 0; i < n; i++) {
+        out[i] = treasureArrays.id[out[i]];
+    }
+    out.resize(n);
+}
+
+void Level::collectTreasure(size_t index) {
+    if (index >= treasures.size()) {
+        return;
+    }
+    treasures[index].collected = true;
+    uint32_t slot = treasureSlot[index];
+    treasureCollected[slot >> 6] |= uint64_t(1) << (slot & 63);
+}
+
+bool Level::isTreasureCollected(size_t index) const {
+    if (index >= treasureSlot.size()) {
+        return false;
+    }
+    uint32_t slot = treasureSlot[index];
+    return (treasureCollected[slot >> 6] >> (slot & 63)) & 1;
 }
@@ -1,6 +1,12 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <memory>
+#include <cstdint>
+#include "ArrayView.h"
+#include "JobSystem.h"
+
+class MappedFile;
 
 struct GroundSegment {
     float startX;
@@ -30,30 +36,183 @@ struct Obstacle {
 
 class Level {
 public:
+    Level();
+    ~Level();
+    Level(Level&&) noexcept;
+    Level& operator=(Level&&) noexcept;
+
+    // Views point into this object's storage or file mapping; no copies
+    Level(const Level&) = delete;
+    Level& operator=(const Level&) = delete;
+
+    // Loads a JSON level, a chunked manifest, or a compiled ".lvlb" level
     bool loadFromFile(const std::string& path);
 
+    // Write the loaded level (with its lookup indexes) in the compiled
+    // binary format. Not supported for streamed levels.
+    bool saveBinary(const std::string& path) const;
+
     float getLength() const { return length; }
     float getGroundY() const { return groundY; }
     const std::string& getName() const { return name; }
 
+    // Bumped whenever the loaded geometry changes (load, chunk streaming),
+    // so caches built from it know to rebuild
+    unsigned getRevision() const { return revision; }
+
     bool hasGroundAt(float worldX) const;
+    // Merged ground intervals overlapping (minX, maxX), in ascending x: a
+    // slice of the index, so drawing the view costs O(log n + visible)
+    ArrayView<const GroundSegment> findGroundInSpan(float minX, float maxX) const;
     float getPlatformSurfaceAt(float worldX, float playerBottomY, float velocityY) const;
 
-    const std::vector<GroundSegment>& getGround() const { return ground; }
-    const std::vector<Platform>& getPlatforms() const { return platforms; }
-    std::vector<Treasure>& getTreasures() { return treasures; }
-    const std::vector<Obstacle>& getObstacles() const { return obstacles; }
+    ArrayView<const GroundSegment> getGround() const { return groundView; }
+    ArrayView<const Platform> getPlatforms() const { return platformsView; }
+    const std::vector<Treasure>& getTreasures() const { return treasures; }
+    ArrayView<const Obstacle> getObstacles() const { return obstaclesView; }
+
+    // Exact queries over the structure-of-arrays copies of the entities,
+    // several at a time (SimdOverlap.h). out receives indices into
+    // getObstacles() / getPlatforms() / getTreasures() in ascending x; it is
+    // resized to fit and keeps its capacity between calls.
+    void findObstaclesOverlapping(float minX, float minY, float maxX, float maxY,
+                                  std::vector<uint32_t>& out) const;
+    void findPlatformsOverlapping(float minX, float minY, float maxX, float maxY,
+                                  std::vector<uint32_t>& out) const;
+    // Uncollected treasures only
+    void findTreasuresInRadius(float x, float y, float radius, std::vector<uint32_t>& out) const;
+    void findTreasuresInSpan(float minX, float maxX, std::vector<uint32_t>& out) const;
+
+    // Mark a treasure collected; the only way to change collected state.
+    // The queries above read a bitset, which Treasure::collected mirrors.
+    void collectTreasure(size_t index);
+    bool isTreasureCollected(size_t index) const;
 
     void reset();
 
+    // Chunked levels: the file loaded is a manifest, and only the chunks
+    // around the view are kept in memory. Call before querying each tick with
+    // the visible world x-range; loads chunks ahead and evicts those behind.
+    // No-op for whole-level files.
+    void streamTo(float viewMinX, float viewMaxX);
+    bool isStreaming() const { return streaming; }
+    size_t getResidentChunkCount() const { return residentChunks.size(); }
+    // A chunk file was missing or bad; its part of the level is empty, so
+    // a run can't be finished. Cleared by reset() and loading.
+    bool hasMissingChunks() const { return missingChunks; }
+
+    // Parse the next chunk past the resident ones as a job, so crossing a
+    // chunk boundary doesn't parse on the thread calling streamTo(). With
+    // none (the default) chunks load in streamTo().
+    void setJobSystem(JobSystem* jobSystem);
+
 private:
+    struct Chunk {
+        int index = 0;
+        std::vector<GroundSegment> ground;
+        std::vector<Platform> platforms;
+        std::vector<Treasure> treasures;
+        std::vector<Obstacle> obstacles;
+    };
+
+    void buildIndex();
+    void buildEntityArrays();
+    void useOwnedStorage();
+    bool loadBinary(const std::string& path);
+    int chunkIndexAt(float worldX) const;
+    static bool loadChunk(const std::string& pathPrefix, int index, Chunk& chunk);
+    bool takeChunk(int index, Chunk& chunk);
+    void prefetchChunk(int index);
+    void dropPrefetch();
+
     std::string name;
+    unsigned revision = 0;
     float length = 0.0f;
     float groundY = 500.0f;
+
+    // Owned storage (JSON and streamed levels). Compiled levels leave these
+    // empty and point the views below into the file mapping instead.
     std::vector<GroundSegment> ground;
     std::vector<Platform> platforms;
     std::vector<Treasure> treasures;
     std::vector<Obstacle> obstacles;
 
     std::vector<Treasure> initialTreasures;  // For reset
+
+    // Streaming state (chunk files are <chunkPathPrefix><index>.json)
+    bool streaming = false;
+    float chunkWidth = 0.0f;
+    int chunkCount = 0;
+    std::string chunkPathPrefix;
+    std::vector<Chunk> residentChunks;  // Sorted by index, contiguous
+    bool missingChunks = false;
+
+    // Chunk being parsed ahead by a job. The job owns a reference to its
+    // result, so the level can move or go away while it runs.
+    struct Prefetch {
+        Chunk chunk;
+        bool loaded = false;
+    };
+    JobSystem* jobs = nullptr;
+    JobHandle prefetchJob;
+    std::shared_ptr<Prefetch> prefetched;
+    int prefetchedIndex = -1;
+
+    // Lookup structures built at load time (or stored in the compiled file)
+    // for O(log n) queries. Ground is merged into sorted, non-overlapping
+    // intervals.
+    std::vector<GroundSegment> groundIndex;
+
+    // Platforms sorted by x. order is the position in the level file, so
+    // overlapping platforms resolve the same way as a front-to-back scan.
+    struct PlatformEntry {
+        float x;
+        float right;
+        float y;
+        uint32_t order;
+    };
+    std::vector<PlatformEntry> platformIndex;
+    float maxPlatformWidth = 0.0f;
+
+    // Obstacles and treasures sorted by x; the order of the structure-of-arrays
+    // copies below and of the compiled .lvlb
+    struct XEntry {
+        float x;
+        uint32_t index;
+    };
+    std::vector<XEntry> obstacleIndex;
+    float maxObstacleWidth = 0.0f;
+    std::vector<XEntry> treasureIndex;
+
+    // What queries and accessors actually read
+    ArrayView<const GroundSegment> groundView;
+    ArrayView<const Platform> platformsView;
+    ArrayView<const Obstacle> obstaclesView;
+    ArrayView<const GroundSegment> groundIndexView;
+    ArrayView<const PlatformEntry> platformIndexView;
+    ArrayView<const XEntry> obstacleIndexView;
+    ArrayView<const XEntry> treasureIndexView;
+
+    // Structure-of-arrays copies in index (ascending x) order for the batched
+    // overlap tests; id maps a slot back to the entity index. Rebuilt with
+    // the index, and for compiled levels after mapping.
+    struct RectArrays {
+        std::vector<float> x, y, w, h;
+        std::vector<uint32_t> id;
+    };
+    RectArrays platformArrays;
+    RectArrays obstacleArrays;
+    struct PointArrays {
+        std::vector<float> x, y;
+        std::vector<uint32_t> id;
+    };
+    PointArrays treasureArrays;
+    std::vector<uint64_t> treasureCollected;  // Bit per treasureArrays slot
+    std::vector<uint32_t> treasureSlot;       // Treasure index -> slot
+
+    std::unique_ptr<MappedFile> mappedFile;  // Compiled levels only
+
+    static void findRects(const RectArrays& rects, float searchStart,
+                          float minX, float minY, float maxX, float maxY,
+                          std::vector<uint32_t>& out);
 };
@@ -1,26 +1,46 @@
 #include "LevelIntroScene.h"
 #include "PlayingScene.h"
+#include "Input.h"
+#include "DisplayManager.h"
 #include <cstdio>
 
+void LevelIntroScene::reuse(int levelNum) {
+    level = levelNum;
+    loader.take();  // A load that was never handed over; start() needs it idle
+}
+
 void LevelIntroScene::onEnter() {
     SDL_Log("LevelIntroScene: Enter (Level %d)", level);
     timer = 0.0f;
-}
+    startRequested = false;
+    getScenes().prepare<PlayingScene>();
 
-void LevelIntroScene::handleEvent(const SDL_Event& event) {
-    if (event.type == SDL_EVENT_KEY_DOWN ||
-        event.type == SDL_EVENT_FINGER_DOWN ||
-        event.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-        requestReplace<PlayingScene>(level);
-    }
+    // Load while the intro is on screen so PlayingScene starts without a hitch
+    GameContext& context = getContext();
+    loader.start("assets/levels/level" + std::to_string(level) + ".json",
+                 context.highScoreFile, *context.jobs, context.highScoreSave);
 }
 
 void LevelIntroScene::update(float deltaTime) {
+    PROFILE_SCOPE("LevelIntroScene::update");
     timer += deltaTime;
-    // Timer available for animations, no auto-advance
+    Input& input = getInput();
+    if (input.anyInput()) {
+        startRequested = true;
+    }
+
+    // No auto-advance; a key press starts once the level is ready. When
+    // recording or replaying, wait for it here instead, so the run starts
+    // on the same tick however long the load takes.
+    bool deterministic = input.isRecording() || input.isReplaying();
+    if (startRequested && (loader.isReady() || deterministic)) {
+        startRequested = false;
+        requestReplace<PlayingScene>(level, loader.take());
+    }
 }
 
 void LevelIntroScene::render(SDL_Renderer* renderer) {
+    PROFILE_SCOPE("LevelIntroScene::render");
     SDL_SetRenderDrawColor(renderer, 40, 40, 80, 255);
     SDL_RenderClear(renderer);
 
@@ -28,23 +48,30 @@ void LevelIntroScene::render(SDL_Renderer* renderer) {
     char levelText[32];
     snprintf(levelText, sizeof(levelText), "LEVEL %d", level);
 
-    SDL_SetRenderScale(renderer, 4.0f, 4.0f);
-    SDL_SetRenderDrawColor(renderer, 100, 200, 255, 255);  // Light blue
-    SDL_RenderDebugText(renderer, 60, 30, levelText);
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    text.addText(levelText, 240, 120, 4.0f, 100, 200, 255);  // Light blue
 
     // Draw "Get Ready!" subtitle
-    SDL_SetRenderScale(renderer, 2.0f, 2.0f);
-    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);  // Light gray
-    SDL_RenderDebugText(renderer, 155, 100, "Get Ready!");
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    text.addText("Get Ready!", 310, 200, 2.0f, 200, 200, 200);  // Light gray
+
+    if (!loader.isReady()) {
+        text.flush(renderer);
+
+        // Loading progress bar in place of the prompt
+        const float barWidth = 300.0f;
+        const float barHeight = 12.0f;
+        SDL_FRect outline = {(DisplayManager::DESIGN_WIDTH - barWidth) / 2.0f, 500.0f, barWidth, barHeight};
+        SDL_FRect fill = {outline.x, outline.y, barWidth * loader.getProgress(), barHeight};
+        SDL_SetRenderDrawColor(renderer, 100, 200, 255, 255);  // Light blue
+        SDL_RenderFillRect(renderer, &fill);
+        SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);  // Light gray
+        SDL_RenderRect(renderer, &outline);
+        return;
+    }
 
     // Draw "Press any key" with blinking effect
     int blink = (int)(timer * 2) % 2;
     if (blink == 0) {
-        SDL_SetRenderScale(renderer, 2.0f, 2.0f);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);  // White
-        SDL_RenderDebugText(renderer, 130, 250, "Press any key");
-        SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+        text.addText("Press any key", 260, 500, 2.0f, 255, 255, 255);  // White
     }
+    text.flush(renderer);
 }
@@ -1,16 +1,28 @@
 #pragma once
 #include "SceneManager.h"
+#include "LevelLoader.h"
+#include "BitmapFont.h"
 
 class LevelIntroScene : public Scene {
 public:
     explicit LevelIntroScene(int levelNum = 1) : level(levelNum) {}
+    void reuse(int levelNum);
 
     void onEnter() override;
-    void handleEvent(const SDL_Event& event) override;
     void update(float deltaTime) override;
     void render(SDL_Renderer* renderer) override;
+    bool isOpaque() const override { return true; }
+    void warmUp(SDL_Renderer* renderer) override { text.prepare(renderer); }
+
+    // Level loading runs in the background while the intro is shown
+    bool isLevelReady() const { return loader.isReady(); }
+    float getLoadProgress() const { return loader.getProgress(); }
+    bool isStartRequested() const { return startRequested; }
 
 private:
     int level;
     float timer = 0.0f;
+    bool startRequested = false;  // Player pressed a key before loading finished
+    LevelLoader loader;
+    BitmapFont text;
 };
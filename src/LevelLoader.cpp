@@ -0,0 +1,100 @@
+#include "LevelLoader.h"
+#include "Score.h"
+#include "DisplayManager.h"
+#include "Profiler.h"
+#include "FrameActivity.h"
+
+LevelLoader::LevelLoader() {
+    SDL_SetAtomicInt(&progress, 0);
+}
+
+LevelLoader::~LevelLoader() {
+    join();
+}
+
+void LevelLoader::start(const std::string& path, const std::string& scoreFile,
+                        JobSystem& jobSystem, const JobHandle& scoreAfter) {
+    if (finished) {
+        return;
+    }
+    levelPath = path;
+    highScoreFile = scoreFile;
+    result = std::make_unique<PreloadedLevel>();
+    SDL_SetAtomicInt(&progress, 0);
+    jobs = &jobSystem;
+
+    // Without workers these run here and now
+    PreloadedLevel* out = result.get();
+    JobHandle level = jobs->run([this, out] { loadLevel(*out); });
+    JobHandle score = jobs->run([this, out] { loadHighScore(*out); }, {scoreAfter});
+    // Publish last: the main thread may take the result once it sees 100
+    finished = jobs->run([this] { SDL_SetAtomicInt(&progress, 100); }, {level, score});
+}
+
+bool LevelLoader::isReady() const {
+    return result && SDL_GetAtomicInt(&progress) >= 100;
+}
+
+float LevelLoader::getProgress() const {
+    return SDL_GetAtomicInt(&progress) / 100.0f;
+}
+
+std::unique_ptr<PreloadedLevel> LevelLoader::take() {
+    join();
+    return std::move(result);
+}
+
+std::string LevelLoader::resolveLevelPath(const std::string& levelPath) {
+    size_t ext = levelPath.rfind(".json");
+    if (ext == std::string::npos) {
+        return levelPath;
+    }
+    std::string compiledPath = levelPath.substr(0, ext) + ".lvlb";
+
+    // SDL_IOFromFile also sees assets packed in an Android APK, which
+    // SDL_GetPathInfo can't
+    SDL_IOStream* compiled = SDL_IOFromFile(compiledPath.c_str(), "rb");
+    if (!compiled) {
+        return levelPath;
+    }
+    SDL_CloseIO(compiled);
+
+    // A .lvlb older than its .json is stale (the level was edited since it
+    // was compiled). Packed assets have no times; those ship together.
+    SDL_PathInfo compiledInfo;
+    SDL_PathInfo sourceInfo;
+    if (SDL_GetPathInfo(compiledPath.c_str(), &compiledInfo) && SDL_GetPathInfo(levelPath.c_str(), &sourceInfo) &&
+        compiledInfo.modify_time < sourceInfo.modify_time) {
+        SDL_Log("LevelLoader: %s is older than %s, loading the JSON", compiledPath.c_str(), levelPath.c_str());
+        return levelPath;
+    }
+    return compiledPath;
+}
+
+void LevelLoader::join() {
+    if (finished) {
+        jobs->wait(finished);
+        finished.reset();
+    }
+}
+
+void LevelLoader::loadLevel(PreloadedLevel& out) {
+    PROFILE_EVENT("LevelLoader::loadLevel");
+    FrameActivityScope activity(FrameActivity::LevelLoad);
+
+    out.loaded = out.level.loadFromFile(resolveLevelPath(levelPath));
+    if (!out.loaded) {
+        SDL_Log("LevelLoader: Failed to load %s", levelPath.c_str());
+    }
+    SDL_SetAtomicInt(&progress, 60);
+
+    // First chunks of a streamed level, so the first frame doesn't stream them
+    out.level.streamTo(0.0f, DisplayManager::DESIGN_WIDTH);
+    SDL_SetAtomicInt(&progress, 90);
+}
+
+void LevelLoader::loadHighScore(PreloadedLevel& out) {
+    if (!highScoreFile.empty()) {
+        out.highScore = Score::readHighScore(highScoreFile);
+    }
+}
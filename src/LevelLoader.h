@@ -0,0 +1,60 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "Level.h"
+#include "JobSystem.h"
+#include <memory>
+#include <string>
+
+// Everything PlayingScene reads from disk before its first frame
+struct PreloadedLevel {
+    Level level;
+    bool loaded = false;  // False if the level file failed to load
+    int highScore = 0;
+};
+
+// Loads a level and the high score as jobs: the level file and the score
+// file are read in parallel, and a last job publishes the result.
+//
+// start() returns immediately; poll isReady()/getProgress() from the main
+// thread and take() the result once ready. The loader owns the result until
+// it is taken and waits for its jobs on destruction.
+class LevelLoader {
+public:
+    LevelLoader();
+    ~LevelLoader();
+
+    LevelLoader(const LevelLoader&) = delete;
+    LevelLoader& operator=(const LevelLoader&) = delete;
+
+    // Begin loading. Ignored if a load is already in flight. An empty
+    // highScoreFile leaves the high score at 0; the score is read once
+    // scoreAfter (a save still in flight, say) is done.
+    void start(const std::string& levelPath,
+               const std::string& highScoreFile = "highscore.dat",
+               JobSystem& jobs = JobSystem::instance(),
+               const JobHandle& scoreAfter = nullptr);
+
+    bool isStarted() const { return finished != nullptr || result != nullptr; }
+    bool isReady() const;
+    float getProgress() const;  // 0..1
+
+    // Hand over the result, helping with the load if it is still running.
+    // Returns nullptr if nothing was started or it was already taken.
+    std::unique_ptr<PreloadedLevel> take();
+
+    // Prefer a compiled .lvlb next to a .json level if one exists and is
+    // at least as new as the .json
+    static std::string resolveLevelPath(const std::string& levelPath);
+
+private:
+    void loadLevel(PreloadedLevel& out);
+    void loadHighScore(PreloadedLevel& out);
+    void join();
+
+    JobSystem* jobs = nullptr;
+    JobHandle finished;              // Publishes the result
+    mutable SDL_AtomicInt progress;  // Percent complete, 100 = ready
+    std::string levelPath;
+    std::string highScoreFile;
+    std::unique_ptr<PreloadedLevel> result;
+};
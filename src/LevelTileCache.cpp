@@ -0,0 +1,92 @@
+#include "LevelTileCache.h"
+#include "RenderStats.h"
+
+LevelTileCache::~LevelTileCache() {
+    release();
+}
+
+void LevelTileCache::invalidate() {
+    for (Slot& slot : slots) {
+        slot.tile = -1;
+    }
+}
+
+void LevelTileCache::release() {
+    for (Slot& slot : slots) {
+        if (slot.texture) {
+            SDL_DestroyTexture(slot.texture);
+        }
+        slot = Slot();
+    }
+    owner = nullptr;
+}
+
+int LevelTileCache::getCachedTileCount() const {
+    int count = 0;
+    for (const Slot& slot : slots) {
+        if (slot.tile >= 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+LevelTileCache::Slot* LevelTileCache::acquire(SDL_Renderer* renderer, int tile, int firstVisible, bool& fresh) {
+    Slot* reusable = nullptr;
+    for (Slot& slot : slots) {
+        if (slot.tile == tile && slot.texture) {
+            fresh = false;
+            return &slot;
+        }
+        // Anything outside the visible pair and the tile ahead can go
+        bool needed = slot.tile >= firstVisible && slot.tile <= firstVisible + 2;
+        if (!needed && !reusable) {
+            reusable = &slot;
+        }
+    }
+    if (!reusable) {
+        return nullptr;
+    }
+
+    if (!reusable->texture) {
+        reusable->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                              static_cast<int>(width), static_cast<int>(height));
+        if (!reusable->texture) {
+            SDL_Log("LevelTileCache: Render targets unavailable, drawing live: %s", SDL_GetError());
+            failed = true;
+            return nullptr;
+        }
+        // Transparent where there is no geometry; pixel-exact when scrolled
+        SDL_SetTextureBlendMode(reusable->texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(reusable->texture, SDL_SCALEMODE_NEAREST);
+    }
+    reusable->tile = tile;
+    fresh = true;
+    return reusable;
+}
+
+bool LevelTileCache::beginTile(SDL_Renderer* renderer, Slot& slot, SDL_Texture*& previousTarget) {
+    previousTarget = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, slot.texture)) {
+        SDL_Log("LevelTileCache: SDL_SetRenderTarget failed: %s", SDL_GetError());
+        slot.tile = -1;
+        failed = true;
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    RenderStats::instance().record(1, 2);
+    tilesRendered++;
+    return true;
+}
+
+void LevelTileCache::endTile(SDL_Renderer* renderer, SDL_Texture* previousTarget) {
+    SDL_SetRenderTarget(renderer, previousTarget);
+    RenderStats::instance().record(0, 1);
+}
+
+void LevelTileCache::draw(SDL_Renderer* renderer, const Slot& slot, float screenX) {
+    SDL_FRect dst = {screenX, 0.0f, width, height};
+    SDL_RenderTexture(renderer, slot.texture, nullptr, &dst);
+    RenderStats::instance().record(1);
+}
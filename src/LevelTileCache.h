@@ -0,0 +1,104 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cmath>
+
+// Static level geometry pre-rendered into screen-sized tile textures.
+//
+// Tile i covers world x [i * tileWidth, (i + 1) * tileWidth). Each frame
+// render() composites the (at most two) tiles under the camera, rendering
+// any that aren't cached yet by calling renderTile(renderer, tileWorldX) with
+// the tile texture as the render target. One tile ahead is rendered on
+// frames that didn't need a new tile, so scrolling rarely waits on one.
+// Three texture slots are recycled; nothing is allocated after warm-up.
+class LevelTileCache {
+public:
+    LevelTileCache() = default;
+    ~LevelTileCache();
+
+    LevelTileCache(const LevelTileCache&) = delete;
+    LevelTileCache& operator=(const LevelTileCache&) = delete;
+
+    // Returns false if tiles can't be used (no render target support); the
+    // caller should draw the static geometry itself that frame
+    template <typename Fn>
+    bool render(SDL_Renderer* renderer, float scrollX, float tileWidth, float tileHeight,
+                unsigned revision, Fn&& renderTile);
+
+    // Forget tile contents (level geometry changed, render targets reset)
+    void invalidate();
+    // Destroy the textures (scene exit, render device lost)
+    void release();
+
+    int getCachedTileCount() const;
+    int getTilesRendered() const { return tilesRendered; }  // Since creation
+
+private:
+    static constexpr int SLOT_COUNT = 3;
+
+    struct Slot {
+        int tile = -1;  // -1 = empty
+        SDL_Texture* texture = nullptr;
+    };
+
+    // Slot holding `tile`, or one recycled for it (fresh = needs rendering)
+    Slot* acquire(SDL_Renderer* renderer, int tile, int firstVisible, bool& fresh);
+    bool beginTile(SDL_Renderer* renderer, Slot& slot, SDL_Texture*& previousTarget);
+    void endTile(SDL_Renderer* renderer, SDL_Texture* previousTarget);
+    void draw(SDL_Renderer* renderer, const Slot& slot, float screenX);
+
+    Slot slots[SLOT_COUNT];
+    SDL_Renderer* owner = nullptr;  // Renderer the textures belong to
+    float width = 0.0f;
+    float height = 0.0f;
+    unsigned cachedRevision = 0;
+    bool failed = false;  // Texture creation failed, stop trying
+    int tilesRendered = 0;
+};
+
+// Implementation
+template <typename Fn>
+bool LevelTileCache::render(SDL_Renderer* renderer, float scrollX, float tileWidth, float tileHeight,
+                            unsigned revision, Fn&& renderTile) {
+    if (failed) {
+        return false;
+    }
+    if (renderer != owner || tileWidth != width || tileHeight != height) {
+        release();
+        owner = renderer;
+        width = tileWidth;
+        height = tileHeight;
+    }
+    if (revision != cachedRevision) {
+        invalidate();
+        cachedRevision = revision;
+    }
+
+    const int firstVisible = static_cast<int>(std::floor(scrollX / width));
+    bool renderedThisFrame = false;
+
+    for (int tile = firstVisible; tile <= firstVisible + 2; tile++) {
+        const bool visible = tile <= firstVisible + 1;
+        if (!visible && renderedThisFrame) {
+            break;  // Prefetch the tile ahead on a quieter frame
+        }
+
+        bool fresh = false;
+        Slot* slot = acquire(renderer, tile, firstVisible, fresh);
+        if (!slot) {
+            return false;
+        }
+        if (fresh) {
+            SDL_Texture* previousTarget = nullptr;
+            if (!beginTile(renderer, *slot, previousTarget)) {
+                return false;
+            }
+            renderTile(renderer, tile * width);
+            endTile(renderer, previousTarget);
+            renderedThisFrame = true;
+        }
+        if (visible) {
+            draw(renderer, *slot, tile * width - scrollX);
+        }
+    }
+    return true;
+}
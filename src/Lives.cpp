@@ -1,4 +1,5 @@
 #include "Lives.h"
+#include "RenderStats.h"
 #include <algorithm>
 #include <cstdio>
 
@@ -26,13 +27,30 @@ void Lives::reset() {
 }
 
 void Lives::render(SDL_Renderer* renderer) {
+    // Redrawn into the cached texture only when the count changes
+    const float heartSize = 20.0f;
+    const float spacing = 5.0f;
+    int slots = std::max(count, startCount);
+    if (slots <= 0) {
+        return;
+    }
+    float width = slots * (heartSize + spacing) - spacing;
+    Uint64 key = (static_cast<Uint64>(static_cast<Uint32>(count)) << 32) | static_cast<Uint32>(startCount);
+
+    hud.render(renderer, key, posX, posY, width, heartSize,
+        [&](SDL_Renderer* target, float originX, float originY) {
+            drawHud(target, originX, originY);
+        });
+}
+
+void Lives::drawHud(SDL_Renderer* renderer, float originX, float originY) {
     // Draw heart icons for each life
     const float heartSize = 20.0f;
     const float spacing = 5.0f;
 
     for (int i = 0; i < count; i++) {
-        float x = posX + i * (heartSize + spacing);
-        float y = posY;
+        float x = originX + i * (heartSize + spacing);
+        float y = originY;
 
         // Draw a simple heart as a red square (placeholder for sprite)
         SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
@@ -43,15 +61,17 @@ void Lives::render(SDL_Renderer* renderer) {
         SDL_SetRenderDrawColor(renderer, 255, 150, 150, 255);
         SDL_FRect highlight = {x + 2, y + 2, 6, 6};
         SDL_RenderFillRect(renderer, &highlight);
+        RenderStats::instance().record(2, 2);
     }
 
     // Draw empty slots for lost lives
     for (int i = count; i < startCount; i++) {
-        float x = posX + i * (heartSize + spacing);
-        float y = posY;
+        float x = originX + i * (heartSize + spacing);
+        float y = originY;
 
         SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
         SDL_FRect rect = {x, y, heartSize, heartSize};
         SDL_RenderFillRect(renderer, &rect);
+        RenderStats::instance().record(1, 1);
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include "HudTexture.h"
 
 class Lives {
 public:
@@ -16,12 +17,18 @@ public:
     void setMax(int max) { maxLives = max; }
     void setPosition(float x, float y) { posX = x; posY = y; }
 
+    // Cached, redrawn when the count changes
     void render(SDL_Renderer* renderer);
+    void releaseTextures() { hud.release(); }
+    int getRedrawCount() const { return hud.getRedrawCount(); }
 
 private:
+    void drawHud(SDL_Renderer* renderer, float originX, float originY);
+
     int count;
     int startCount;
     int maxLives;
     float posX = 10.0f;
     float posY = 10.0f;
+    HudTexture hud;
 };
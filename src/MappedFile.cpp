@@ -0,0 +1,96 @@
+#include "MappedFile.h"
+#include <SDL3/SDL.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif !defined(__ANDROID__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPEDFILE_POSIX
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (view) {
+                    bytes = static_cast<const unsigned char*>(view);
+                    length = static_cast<size_t>(fileSize.QuadPart);
+                    mapped = true;
+                    fileHandle = file;
+                    mappingHandle = mapping;
+                    return true;
+                }
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+    }
+#elif defined(MAPPEDFILE_POSIX)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view != MAP_FAILED) {
+                ::close(fd);  // The mapping stays valid after closing the descriptor
+                bytes = static_cast<const unsigned char*>(view);
+                length = static_cast<size_t>(st.st_size);
+                mapped = true;
+                return true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+
+    // Fallback (and the Android path): read it through SDL_IOStream
+    size_t size = 0;
+    void* buffer = SDL_LoadFile(path.c_str(), &size);
+    if (!buffer) {
+        return false;
+    }
+    bytes = static_cast<const unsigned char*>(buffer);
+    length = size;
+    mapped = false;
+    return true;
+}
+
+void MappedFile::close() {
+    if (!bytes) {
+        return;
+    }
+
+    if (!mapped) {
+        SDL_free(const_cast<unsigned char*>(bytes));
+    } else {
+#if defined(_WIN32)
+        UnmapViewOfFile(bytes);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#elif defined(MAPPEDFILE_POSIX)
+        munmap(const_cast<unsigned char*>(bytes), length);
+#endif
+    }
+
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+}
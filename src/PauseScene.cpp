@@ -0,0 +1,31 @@
+#include "PauseScene.h"
+#include "Input.h"
+#include "DisplayManager.h"
+
+void PauseScene::onEnter() {
+    SDL_Log("PauseScene: Enter");
+    timer = 0.0f;
+}
+
+void PauseScene::update(float deltaTime) {
+    PROFILE_SCOPE("PauseScene::update");
+    timer += deltaTime;
+    Input& input = getInput();
+    if (input.justPressed(Action::Pause) || input.anyConfirmInput()) {
+        requestPop();
+    }
+}
+
+void PauseScene::render(SDL_Renderer* renderer) {
+    PROFILE_SCOPE("PauseScene::render");
+    dim.addRect({0.0f, 0.0f, DisplayManager::DESIGN_WIDTH, DisplayManager::DESIGN_HEIGHT}, 0, 0, 0, 160);
+    dim.flush(renderer);
+
+    const float centerX = DisplayManager::DESIGN_WIDTH / 2.0f;
+    text.addTextCentered("PAUSED", centerX, 220, 4.0f, 255, 255, 255);
+    int blink = (int)(timer * 2) % 2;
+    if (blink == 0) {
+        text.addTextCentered("Press P to resume", centerX, 320, 2.0f, 200, 200, 200);
+    }
+    text.flush(renderer);
+}
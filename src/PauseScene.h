@@ -0,0 +1,22 @@
+#pragma once
+#include "SceneManager.h"
+#include "RenderBatch.h"
+#include "BitmapFont.h"
+
+// Overlay pushed over PlayingScene by the Pause action. The game below is
+// frozen (only the top scene updates) and drawn once under a dimmed panel;
+// Pause or Confirm pops back to it.
+class PauseScene : public Scene {
+public:
+    void reuse() {}
+
+    void onEnter() override;
+    void update(float deltaTime) override;
+    void render(SDL_Renderer* renderer) override;
+    void warmUp(SDL_Renderer* renderer) override { text.prepare(renderer); }
+
+private:
+    float timer = 0.0f;
+    RenderBatch dim;
+    BitmapFont text;
+};
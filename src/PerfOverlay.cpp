@@ -0,0 +1,240 @@
+#include "PerfOverlay.h"
+#include "DisplayManager.h"
+#include "Level.h"
+#include <algorithm>
+#include <cstdio>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#elif defined(__GLIBC__) || defined(__ANDROID__)
+#include <malloc.h>
+#endif
+
+namespace {
+    const float PANEL_X = 10.0f;
+    const float PADDING = 4.0f;
+    const float LINE_HEIGHT = 10.0f;
+    const int TEXT_LINES = 5;
+    const float GRAPH_HEIGHT = 40.0f;
+    const float BAR_WIDTH = 2.0f;
+}
+
+void PerfOverlay::setEnabled(bool enable) {
+    if (enable == enabled) {
+        return;
+    }
+    enabled = enable;
+    SDL_Log("PerfOverlay: %s", enabled ? "On" : "Off");
+
+    // Start from a clean slate rather than showing stale frames
+    graphNext = 0;
+    graphCount = 0;
+    frameUpdateTicks = 0;
+    frameRenderTicks = 0;
+    intervalSeconds = 0.0f;
+    intervalFrames = 0;
+    intervalMaxMs = 0.0f;
+    intervalUpdateTicks = 0;
+    intervalRenderTicks = 0;
+    intervalDrawCalls = 0;
+    refreshCount = 0;
+    stats = Stats();
+    hud.invalidate();
+    hud.resetRedrawCount();
+    if (!enabled) {
+        releaseTextures();
+    }
+}
+
+void PerfOverlay::setRefreshRate(float hz) {
+    if (hz > 0.0f) {
+        vsyncIntervalMs = 1000.0f / hz;
+    }
+}
+
+void PerfOverlay::handleEvent(const SDL_Event& event) {
+    if (event.type == SDL_EVENT_KEY_DOWN && event.key.scancode == SDL_SCANCODE_F3 && !event.key.repeat) {
+        toggle();
+    } else if (event.type == SDL_EVENT_RENDER_TARGETS_RESET) {
+        hud.invalidate();
+    } else if (event.type == SDL_EVENT_RENDER_DEVICE_RESET) {
+        releaseTextures();
+    }
+}
+
+void PerfOverlay::recordFrame(float frameSeconds, int drawCalls) {
+    if (!enabled) {
+        return;
+    }
+    const double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    float frameMs = frameSeconds * 1000.0f;
+
+    graphFrameMs[graphNext] = frameMs;
+    graphCpuMs[graphNext] = (float)((double)(frameUpdateTicks + frameRenderTicks) * msPerTick);
+    graphNext = (graphNext + 1) % GRAPH_FRAMES;
+    if (graphCount < GRAPH_FRAMES) {
+        graphCount++;
+    }
+
+    intervalSeconds += frameSeconds;
+    intervalFrames++;
+    intervalMaxMs = std::max(intervalMaxMs, frameMs);
+    intervalUpdateTicks += frameUpdateTicks;
+    intervalRenderTicks += frameRenderTicks;
+    intervalDrawCalls += (Uint64)drawCalls;
+    frameUpdateTicks = 0;
+    frameRenderTicks = 0;
+
+    if (intervalSeconds >= REFRESH_INTERVAL) {
+        refresh();
+    }
+}
+
+void PerfOverlay::refresh() {
+    const double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    const float frames = (float)intervalFrames;
+
+    stats.fps = intervalSeconds > 0.0f ? frames / intervalSeconds : 0.0f;
+    stats.avgFrameMs = intervalSeconds * 1000.0f / frames;
+    stats.maxFrameMs = intervalMaxMs;
+    stats.updateMs = (float)((double)intervalUpdateTicks * msPerTick / frames);
+    stats.renderMs = (float)((double)intervalRenderTicks * msPerTick / frames);
+    stats.drawCalls = (float)intervalDrawCalls / frames;
+
+    stats.haveLevel = level != nullptr;
+    if (level) {
+        stats.ground = (int)level->getGround().size();
+        stats.platforms = (int)level->getPlatforms().size();
+        stats.obstacles = (int)level->getObstacles().size();
+        stats.treasures = 0;
+        for (const Treasure& treasure : level->getTreasures()) {
+            if (!treasure.collected) {
+                stats.treasures++;
+            }
+        }
+    }
+    stats.heapBytes = readHeapBytes();
+
+    intervalSeconds = 0.0f;
+    intervalFrames = 0;
+    intervalMaxMs = 0.0f;
+    intervalUpdateTicks = 0;
+    intervalRenderTicks = 0;
+    intervalDrawCalls = 0;
+    refreshCount++;
+}
+
+float PerfOverlay::getGraphMs(int age) const {
+    if (age < 0 || age >= graphCount) {
+        return 0.0f;
+    }
+    return graphFrameMs[(graphNext - 1 - age + GRAPH_FRAMES) % GRAPH_FRAMES];
+}
+
+void PerfOverlay::render(SDL_Renderer* renderer) {
+    if (!enabled) {
+        return;
+    }
+    // The graph moves every frame but is only redrawn with the numbers
+    float y = DisplayManager::DESIGN_HEIGHT - PANEL_HEIGHT - 10.0f;
+    hud.render(renderer, (Uint64)refreshCount, PANEL_X, y, PANEL_WIDTH, PANEL_HEIGHT,
+        [&](SDL_Renderer* target, float originX, float originY) {
+            drawPanel(target, originX, originY);
+        });
+}
+
+void PerfOverlay::releaseTextures() {
+    hud.release();
+    text.release();
+}
+
+void PerfOverlay::drawPanel(SDL_Renderer* renderer, float originX, float originY) {
+    batch.addRect({originX, originY, PANEL_WIDTH, PANEL_HEIGHT}, 0, 0, 0, 180);
+
+    // Bars oldest to newest, left to right; the full graph height is two
+    // vsync intervals, and frames over 1.5 intervals (missed vsync) are red
+    const float graphTop = originY + PADDING + TEXT_LINES * LINE_HEIGHT + PADDING;
+    const float graphBottom = graphTop + GRAPH_HEIGHT;
+    const float graphLeft = originX + PADDING;
+    const float fullScaleMs = vsyncIntervalMs * 2.0f;
+    const float missedMs = vsyncIntervalMs * 1.5f;
+    auto barHeight = [&](float ms) { return std::min(ms / fullScaleMs, 1.0f) * GRAPH_HEIGHT; };
+
+    batch.addRect({graphLeft, graphTop, GRAPH_FRAMES * BAR_WIDTH, GRAPH_HEIGHT}, 40, 40, 40, 200);
+    for (int i = 0; i < graphCount; i++) {
+        int age = graphCount - 1 - i;
+        int slot = (graphNext - 1 - age + GRAPH_FRAMES) % GRAPH_FRAMES;
+        float x = graphLeft + (GRAPH_FRAMES - graphCount + i) * BAR_WIDTH;
+        float frameHeight = barHeight(graphFrameMs[slot]);
+        if (graphFrameMs[slot] > missedMs) {
+            batch.addRect({x, graphBottom - frameHeight, BAR_WIDTH, frameHeight}, 220, 60, 60);
+        } else {
+            batch.addRect({x, graphBottom - frameHeight, BAR_WIDTH, frameHeight}, 60, 180, 60);
+        }
+        // CPU share of the frame in front; the rest is waiting on vsync/GPU
+        float cpuHeight = barHeight(graphCpuMs[slot]);
+        batch.addRect({x, graphBottom - cpuHeight, BAR_WIDTH, cpuHeight}, 240, 200, 60);
+    }
+    batch.addRect({graphLeft, graphBottom - barHeight(vsyncIntervalMs), GRAPH_FRAMES * BAR_WIDTH, 1.0f},
+                  255, 255, 255, 160);
+    batch.flush(renderer);
+
+    char line[64];
+    float textX = originX + PADDING;
+    float textY = originY + PADDING;
+
+    snprintf(line, sizeof(line), "FPS %.1f  avg %.1f  max %.1f ms", stats.fps, stats.avgFrameMs, stats.maxFrameMs);
+    text.addText(line, textX, textY, 1.0f, 255, 255, 255);
+    textY += LINE_HEIGHT;
+
+    snprintf(line, sizeof(line), "CPU upd %.2f  ren %.2f ms", stats.updateMs, stats.renderMs);
+    text.addText(line, textX, textY, 1.0f, 240, 200, 60);
+    textY += LINE_HEIGHT;
+
+    snprintf(line, sizeof(line), "Draw calls %.1f", stats.drawCalls);
+    text.addText(line, textX, textY, 1.0f, 255, 255, 255);
+    textY += LINE_HEIGHT;
+
+    if (stats.haveLevel) {
+        snprintf(line, sizeof(line), "Gnd %d  Plat %d  Tre %d  Obs %d",
+                 stats.ground, stats.platforms, stats.treasures, stats.obstacles);
+    } else {
+        snprintf(line, sizeof(line), "No level");
+    }
+    text.addText(line, textX, textY, 1.0f, 255, 255, 255);
+    textY += LINE_HEIGHT;
+
+    if (stats.heapBytes > 0) {
+        snprintf(line, sizeof(line), "Heap %.1f MB", (double)stats.heapBytes / (1024.0 * 1024.0));
+    } else {
+        snprintf(line, sizeof(line), "Heap n/a");
+    }
+    text.addText(line, textX, textY, 1.0f, 255, 255, 255);
+
+    text.flush(renderer);
+}
+
+Uint64 PerfOverlay::readHeapBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS_EX counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters),
+                             sizeof(counters))) {
+        return (Uint64)counters.PrivateUsage;
+    }
+    return 0;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return (Uint64)info.uordblks + (Uint64)info.hblkhd;
+#elif defined(__GLIBC__) || defined(__ANDROID__)
+    struct mallinfo info = mallinfo();
+    return (Uint64)(unsigned)info.uordblks + (Uint64)(unsigned)info.hblkhd;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "HudTexture.h"
+#include "BitmapFont.h"
+#include "RenderBatch.h"
+
+class Level;
+
+// On-screen performance panel, drawn by SceneManager above every scene:
+// a rolling frame-time graph plus CPU update/render time, draw calls, the
+// current level's resident entity counts and heap usage. F3 toggles it.
+//
+// Frame times go into the graph every frame, but the numbers and the panel
+// texture are only rebuilt every REFRESH_INTERVAL seconds; in between it
+// costs one textured quad, so it can stay on during playtests.
+class PerfOverlay {
+public:
+    static constexpr int GRAPH_FRAMES = 120;
+    static constexpr float REFRESH_INTERVAL = 0.25f;
+    static constexpr float PANEL_WIDTH = 248.0f;
+    static constexpr float PANEL_HEIGHT = 104.0f;
+
+    struct Stats {
+        float fps = 0.0f;
+        float avgFrameMs = 0.0f;
+        float maxFrameMs = 0.0f;
+        float updateMs = 0.0f;  // Per frame, summed over the ticks it ran
+        float renderMs = 0.0f;
+        float drawCalls = 0.0f;
+        bool haveLevel = false;
+        int ground = 0;
+        int platforms = 0;
+        int treasures = 0;  // Uncollected
+        int obstacles = 0;
+        Uint64 heapBytes = 0;  // 0 if the platform can't tell us
+    };
+
+    static PerfOverlay& instance() {
+        static PerfOverlay overlay;
+        return overlay;
+    }
+
+    void setEnabled(bool enable);
+    bool isEnabled() const { return enabled; }
+    void toggle() { setEnabled(!enabled); }
+
+    void setRefreshRate(float hz);
+
+    // F3 toggles; render resets drop the cached textures
+    void handleEvent(const SDL_Event& event);
+
+    // CPU time spent in scene update / render this frame (SceneManager)
+    void addUpdateTime(Uint64 ticks) { frameUpdateTicks += ticks; }
+    void addRenderTime(Uint64 ticks) { frameRenderTicks += ticks; }
+
+    // Close a frame (PerformanceMonitor::frameEnd); refreshes the numbers
+    // once REFRESH_INTERVAL has passed
+    void recordFrame(float frameSeconds, int drawCalls);
+
+    // Level whose entities are counted; its owner clears it before the
+    // level goes away
+    void setLevel(const Level* current) { level = current; }
+    void clearLevel(const Level* owned) {
+        if (level == owned) {
+            level = nullptr;
+        }
+    }
+
+    void render(SDL_Renderer* renderer);
+    void releaseTextures();
+
+    const Stats& getStats() const { return stats; }
+    float getGraphMs(int age) const;  // 0 = most recent frame
+    int getGraphCount() const { return graphCount; }
+    int getRefreshCount() const { return refreshCount; }
+    int getRedrawCount() const { return hud.getRedrawCount(); }
+
+    // Bytes currently allocated from the C heap, or 0 if unknown
+    static Uint64 readHeapBytes();
+
+private:
+    PerfOverlay() = default;
+
+    void refresh();
+    void drawPanel(SDL_Renderer* renderer, float originX, float originY);
+
+    bool enabled = false;
+    float vsyncIntervalMs = 1000.0f / 60.0f;
+
+    // Graph ring buffer: total frame and CPU (update + render) time in ms
+    float graphFrameMs[GRAPH_FRAMES] = {};
+    float graphCpuMs[GRAPH_FRAMES] = {};
+    int graphNext = 0;
+    int graphCount = 0;
+
+    Uint64 frameUpdateTicks = 0;
+    Uint64 frameRenderTicks = 0;
+
+    // Accumulated since the last refresh
+    float intervalSeconds = 0.0f;
+    int intervalFrames = 0;
+    float intervalMaxMs = 0.0f;
+    Uint64 intervalUpdateTicks = 0;
+    Uint64 intervalRenderTicks = 0;
+    Uint64 intervalDrawCalls = 0;
+
+    const Level* level = nullptr;
+    Stats stats;
+    int refreshCount = 0;
+
+    HudTexture hud;
+    RenderBatch batch;
+    BitmapFont text;
+};
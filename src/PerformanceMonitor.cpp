@@ -1,6 +1,14 @@
 #include "PerformanceMonitor.h"
+#include "RenderStats.h"
+#include "Profiler.h"
+#include "PerfOverlay.h"
+#include "LatencyTracker.h"
+#include <fstream>
 
 void PerformanceMonitor::frameStart() {
+#if MYGAME_PROFILING
+    Profiler::instance().beginFrame();
+#endif
     frameStartTime = SDL_GetPerformanceCounter();
 }
 
@@ -14,12 +22,21 @@ void PerformanceMonitor::frameEnd() {
     frameCount++;
     elapsedTime += processingTime;
 
+    RenderStats& renderStats = RenderStats::instance();
+    int frameDrawCalls = renderStats.getDrawCalls();
+    totalDrawCalls += renderStats.getDrawCalls();
+    totalCommands += renderStats.getCommands();
+    renderStats.reset();
+
     // Also need to account for time waiting in VSync
     // We'll use a simple approximation based on last deltaTime
-    static Uint64 lastFrameEnd = 0;
+    Uint32 activity = FrameActivity::instance().consume();
     if (lastFrameEnd > 0) {
         float totalFrameTime = (float)(frameEndTime - lastFrameEnd) / (float)freq;
         elapsedTime = elapsedTime - processingTime + totalFrameTime;
+        intervalFrames.record(totalFrameTime, activity);
+        sessionFrames.record(totalFrameTime, activity);
+        PerfOverlay::instance().recordFrame(totalFrameTime, frameDrawCalls);
     }
     lastFrameEnd = frameEndTime;
 
@@ -28,11 +45,42 @@ void PerformanceMonitor::frameEnd() {
         float vsyncIntervalMs = (elapsedTime / frameCount) * 1000.0f;
         float utilizationPercent = (totalProcessingTime / elapsedTime) * 100.0f;
 
-        SDL_Log("Performance: %.2fms avg processing / %.2fms frame = %.1f%% utilization",
-                avgProcessingMs, vsyncIntervalMs, utilizationPercent);
+        SDL_Log("Performance: %.2fms avg processing / %.2fms frame = %.1f%% utilization, "
+                "%.1f draw calls / %.1f render commands per frame",
+                avgProcessingMs, vsyncIntervalMs, utilizationPercent,
+                (double)totalDrawCalls / frameCount, (double)totalCommands / frameCount);
+        SDL_Log("Frame times: %s", intervalFrames.summary().c_str());
+        intervalFrames.reset();
+        const LatencyTracker& latency = LatencyTracker::instance();
+        if (latency.isEnabled() && latency.getCount() > 0) {
+            SDL_Log("Input latency: %s", latency.summary().c_str());
+        }
+#if MYGAME_PROFILING
+        Profiler::instance().logSummary(frameCount);
+        Profiler::instance().resetSummary();
+#endif
 
         totalProcessingTime = 0.0f;
+        totalDrawCalls = 0;
+        totalCommands = 0;
         frameCount = 0;
         elapsedTime = 0.0f;
     }
 }
+
+void PerformanceMonitor::setRefreshRate(float hz) {
+    intervalFrames.setRefreshRate(hz);
+    sessionFrames.setRefreshRate(hz);
+    PerfOverlay::instance().setRefreshRate(hz);
+}
+
+bool PerformanceMonitor::writeFrameStats(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        SDL_Log("PerformanceMonitor: Failed to open %s", path.c_str());
+        return false;
+    }
+    file << sessionFrames.toJson() << "\n";
+    SDL_Log("PerformanceMonitor: Session frame times: %s", sessionFrames.summary().c_str());
+    return true;
+}
@@ -1,15 +1,40 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include "TraceExporter.h"
+#include "FrameHistogram.h"
+#include <string>
 
 class PerformanceMonitor {
 public:
     void frameStart();
     void frameEnd();
 
+    // Display refresh rate, for counting frames that missed vsync
+    void setRefreshRate(float hz);
+
+    // Frame times since startup, and the same numbers as a JSON file
+    const FrameHistogram& getSessionHistogram() const { return sessionFrames; }
+    bool writeFrameStats(const std::string& path) const;
+
+    // Dump the profiler history as a Chrome trace, written in the background
+    bool captureTrace(const std::string& path) { return traceExporter.capture(Profiler::instance(), path); }
+    bool waitForTrace() { return traceExporter.wait(); }
+
 private:
     Uint64 frameStartTime = 0;
+    Uint64 lastFrameEnd = 0;
     float totalProcessingTime = 0.0f;
     int frameCount = 0;
     float elapsedTime = 0.0f;
     float reportInterval = 5.0f;
+
+    // Render submissions (RenderStats) summed over the report interval
+    Uint64 totalDrawCalls = 0;
+    Uint64 totalCommands = 0;
+
+    // Full frame times (frameEnd to frameEnd, vsync wait included)
+    FrameHistogram intervalFrames;
+    FrameHistogram sessionFrames;
+
+    TraceExporter traceExporter;
 };
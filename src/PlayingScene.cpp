@@ -1,25 +1,76 @@
 #include "PlayingScene.h"
 #include "GameOverScene.h"
+#include "PauseScene.h"
 #include "Input.h"
 #include "DisplayManager.h"
-#include <cmath>
+#include "RenderStats.h"
+#include <algorithm>
+#include <limits>
+#include <cstdio>
+
+void PlayingScene::reuse(int levelNum) {
+    levelNumber = levelNum;
+    levelPath = "assets/levels/level" + std::to_string(levelNum) + ".json";
+    resetRun();
+}
+
+void PlayingScene::reuse(const std::string& levelFile) {
+    levelNumber = 0;
+    levelPath = levelFile;
+    resetRun();
+}
+
+void PlayingScene::reuse(int levelNum, std::unique_ptr<PreloadedLevel> preloadedLevel) {
+    reuse(levelNum);
+    preloaded = std::move(preloadedLevel);
+}
+
+void PlayingScene::resetRun() {
+    // What the constructor sets up and onEnter() doesn't
+    preloaded.reset();
+    player = Character1(PLAYER_X, 500.0f);
+    lives.reset();
+    score.reset();
+}
 
 void PlayingScene::onEnter() {
     SDL_Log("PlayingScene: Enter (Level %d)", levelNumber);
 
-    // Load level file
-    std::string levelPath = "assets/levels/level" + std::to_string(levelNumber) + ".json";
-    if (!level.loadFromFile(levelPath)) {
-        SDL_Log("PlayingScene: Failed to load level, using defaults");
-    }
+    if (preloaded) {
+        // Loaded on LevelIntroScene's worker thread, just take ownership
+        if (!preloaded->loaded) {
+            SDL_Log("PlayingScene: Failed to load level, using defaults");
+        }
+        level = std::move(preloaded->level);
+        score.setHighScore(preloaded->highScore);
+        preloaded.reset();
+    } else {
+        // Load level file, preferring a compiled .lvlb built next to the JSON
+        PROFILE_EVENT("PlayingScene::loadLevel");
+        FrameActivityScope activity(FrameActivity::LevelLoad);
+        if (!level.loadFromFile(LevelLoader::resolveLevelPath(levelPath))) {
+            SDL_Log("PlayingScene: Failed to load level, using defaults");
+            level = Level();  // Not whatever a recycled scene last played
+        }
+
+        // Load high score from file, once any save in flight has landed
+        GameContext& context = getContext();
+        if (!context.highScoreFile.empty()) {
+            context.jobs->wait(context.highScoreSave);
+            score.loadHighScore(context.highScoreFile);
+        }
 
-    // Load high score from file
-    score.loadHighScore();
+        // Bring in the first chunks of a streamed level
+        level.streamTo(0.0f, DisplayManager::DESIGN_WIDTH);
+    }
+    // Parse the chunk ahead of a streamed level off this thread
+    level.setJobSystem(getContext().jobs);
 
     // Position player at start
     player.setPosition(PLAYER_X, level.getGroundY());
     player.landOn(level.getGroundY());
     distanceTraveled = 0.0f;
+    prevDistanceTraveled = 0.0f;
 
     // Reset death pause state
     inDeathPause = false;
@@ -29,17 +80,56 @@ void PlayingScene::onEnter() {
     // Position UI elements
     lives.setPosition(10.0f, 10.0f);
     score.setPosition(DisplayManager::DESIGN_WIDTH - 10.0f, 10.0f);
+
+    overlay = getContext().overlay;
+    if (overlay) {
+        overlay->setLevel(&level);
+    }
+
+    // Where this scene can go next
+    getScenes().prepare<GameOverScene>(false);
+    getScenes().prepare<PauseScene>();
 }
 
 void PlayingScene::onExit() {
     SDL_Log("PlayingScene: Exit");
+    if (overlay) {
+        overlay->clearLevel(&level);
+    }
+    tileCache.release();
+    lives.releaseTextures();
+    score.releaseTextures();
+    text.release();
+
+    // A pooled scene shouldn't hold the level (entities, streamed chunks,
+    // a compiled level's file mapping) until its next run
+    level = Level();
 }
 
 void PlayingScene::handleEvent(const SDL_Event& event) {
     // Input events handled by Input manager
+
+    // Cached textures lose their contents (or the textures themselves)
+    // when the GPU resets them
+    if (event.type == SDL_EVENT_RENDER_TARGETS_RESET) {
+        tileCache.invalidate();
+        lives.releaseTextures();
+        score.releaseTextures();
+        text.release();
+    } else if (event.type == SDL_EVENT_RENDER_DEVICE_RESET) {
+        tileCache.release();
+        lives.releaseTextures();
+        score.releaseTextures();
+        text.release();
+    }
 }
 
 void PlayingScene::update(float deltaTime) {
+    PROFILE_SCOPE("PlayingScene::update");
+    // Snapshot state for render interpolation
+    player.storePreviousPosition();
+    prevDistanceTraveled = distanceTraveled;
+
     // Handle death pause
     if (inDeathPause) {
         deathPauseTimer += deltaTime;
@@ -55,22 +145,40 @@ void PlayingScene::update(float deltaTime) {
         return;  // Don't update game during death pause
     }
 
-    Input& input = Input::instance();
+    Input& input = getInput();
 
     // Check for back/escape
     if (input.justPressed(Action::Back)) {
-        score.saveHighScore();
+        saveHighScore();
         requestReplace<GameOverScene>(true, score.getValue(), score.getHighScore());
         return;
     }
 
-    // Jump input
-    if (input.justPressed(Action::Jump)) {
-        player.jump();
+    // Pause menu as an overlay; this scene stays put underneath
+    if (input.justPressed(Action::Pause)) {
+        requestPush<PauseScene>();
+        return;
+    }
+
+    // Keep level chunks around the view resident (no-op for whole levels)
+    level.streamTo(distanceTraveled, distanceTraveled + DisplayManager::DESIGN_WIDTH);
+    if (level.hasMissingChunks()) {
+        // Empty where the chunk should be, so the run can't be finished
+        SDL_Log("PlayingScene: Level %d is missing a chunk, ending the run", levelNumber);
+        saveHighScore();
+        requestReplace<GameOverScene>(false, score.getValue(), score.getHighScore());
+        return;
     }
 
-    // Apply gravity
-    player.applyGravity(deltaTime);
+    // Jump input, taken at the point in the tick where it was pressed:
+    // standing still until then, so only the rest of the tick is airborne
+    float jumpFraction = 0.0f;
+    if (input.consumePress(Action::Jump, jumpFraction) && player.isGrounded()) {
+        player.jump();
+        player.applyGravity(deltaTime * (1.0f - jumpFraction));
+    } else {
+        player.applyGravity(deltaTime);
+    }
 
     // Calculate player's world X position (check both edges for landing)
     float playerWorldX = PLAYER_X + distanceTraveled;
@@ -112,7 +220,7 @@ void PlayingScene::update(float deltaTime) {
     float finishLineX = level.getLength();
     if (playerWorldX >= finishLineX) {
         SDL_Log("PlayingScene: Level %d complete!", levelNumber);
-        score.saveHighScore();
+        saveHighScore();
         requestReplace<GameOverScene>(true, score.getValue(), score.getHighScore());
         return;
     }
@@ -121,7 +229,27 @@ void PlayingScene::update(float deltaTime) {
     player.update(deltaTime);
 }
 
+Uint32 PlayingScene::getStateChecksum() const {
+    // FNV-1a over the exact bit patterns, so any drift shows
+    Uint32 hash = 2166136261u;
+    auto mix = [&hash](const void* data, size_t bytes) {
+        const Uint8* p = static_cast<const Uint8*>(data);
+        for (size_t i = 0; i < bytes; i++) {
+            hash = (hash ^ p[i]) * 16777619u;
+        }
+    };
+    const float values[] = {player.getX(), player.getY(), player.getVelocityY(), distanceTraveled, deathPauseTimer};
+    mix(values, sizeof(values));
+    int counts[] = {score.getValue(), lives.getCount(), inDeathPause ? 1 : 0, 0};
+    for (const Treasure& treasure : level.getTreasures()) {
+        counts[3] += treasure.collected ? 0 : 1;
+    }
+    mix(counts, sizeof(counts));
+    return hash;
+}
+
 void PlayingScene::checkCollisions() {
+    PROFILE_SCOPE("PlayingScene::checkCollisions");
     float playerWorldX = PLAYER_X + distanceTraveled;
     float playerY = player.getY();
     float halfSize = PLAYER_SIZE / 2.0f;
@@ -132,34 +260,23 @@ void PlayingScene::checkCollisions() {
     float playerTop = playerY - PLAYER_SIZE;
     float playerBottom = playerY;
 
-    // Check obstacle collisions (AABB)
-    for (const auto& obs : level.getObstacles()) {
-        float obsRight = obs.x + obs.width;
-        float obsBottom = obs.y + obs.height;
-
-        if (playerLeft < obsRight && playerRight > obs.x &&
-            playerTop < obsBottom && playerBottom > obs.y) {
-            SDL_Log("PlayingScene: Hit obstacle at %.0f", obs.x);
-            loseLife();
-            return;
-        }
+    // Check obstacle collisions (AABB); results are in ascending x
+    level.findObstaclesOverlapping(playerLeft, playerTop, playerRight, playerBottom, queryResults);
+    if (!queryResults.empty()) {
+        SDL_Log("PlayingScene: Hit obstacle at %.0f", level.getObstacles()[queryResults[0]].x);
+        loseLife();
+        return;
     }
 
-    // Check treasure collection
+    // Check treasure collection (compare squared distances, no sqrt)
     float playerCenterY = playerY - PLAYER_SIZE / 2.0f;
-    for (auto& treasure : level.getTreasures()) {
-        if (treasure.collected) continue;
-
-        float dx = playerWorldX - treasure.x;
-        float dy = playerCenterY - treasure.y;
-        float distance = std::sqrt(dx * dx + dy * dy);
-
-        float collectionRadius = PLAYER_SIZE / 2.0f + 15.0f;
-        if (distance < collectionRadius) {
-            treasure.collected = true;
-            score.add(treasure.points);
-            SDL_Log("PlayingScene: Collected treasure worth %d points", treasure.points);
-        }
+    const float collectionRadius = PLAYER_SIZE / 2.0f + 15.0f;
+    level.findTreasuresInRadius(playerWorldX, playerCenterY, collectionRadius, queryResults);
+    for (uint32_t i : queryResults) {
+        int points = level.getTreasures()[i].points;
+        level.collectTreasure(i);
+        score.add(points);
+        SDL_Log("PlayingScene: Collected treasure worth %d points", points);
     }
 }
 
@@ -171,52 +288,56 @@ void PlayingScene::loseLife() {
     if (lives.isGameOver()) {
         SDL_Log("PlayingScene: Game Over!");
         gameOverPending = true;
-        score.saveHighScore();
+        saveHighScore();
     } else {
         SDL_Log("PlayingScene: Lost a life, restarting level. Lives remaining: %d", lives.getCount());
         gameOverPending = false;
     }
 }
 
+void PlayingScene::saveHighScore() {
+    // Written by a job so the file I/O stays off the main thread; saves
+    // land in order, each after the one before
+    GameContext& context = getContext();
+    if (context.highScoreFile.empty()) {
+        return;
+    }
+    std::string file = context.highScoreFile;
+    int value = score.getHighScore();
+    context.highScoreSave = context.jobs->run([file, value] { Score::writeHighScore(file, value); },
+                                              {context.highScoreSave});
+}
+
 void PlayingScene::restartLevel() {
     level.reset();
+    level.streamTo(0.0f, DisplayManager::DESIGN_WIDTH);
     distanceTraveled = 0.0f;
+    prevDistanceTraveled = 0.0f;
     player.setPosition(PLAYER_X, level.getGroundY());
     player.landOn(level.getGroundY());
 }
 
 void PlayingScene::render(SDL_Renderer* renderer) {
+    PROFILE_SCOPE("PlayingScene::render");
     // During death pause, show black screen with message
     if (inDeathPause) {
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
 
         // Show "OUCH!" or "GAME OVER" message
-        SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
-        float scale = 3.0f;
-        SDL_SetRenderScale(renderer, scale, scale);
-
+        const float centerX = DisplayManager::DESIGN_WIDTH / 2.0f;
+        const float centerY = DisplayManager::DESIGN_HEIGHT / 2.0f;
         const char* message = gameOverPending ? "GAME OVER" : "OUCH!";
-        float textWidth = strlen(message) * 8.0f;  // Approximate character width
-        float x = (DisplayManager::DESIGN_WIDTH / scale - textWidth) / 2.0f;
-        float y = DisplayManager::DESIGN_HEIGHT / scale / 2.0f - 8.0f;
-
-        SDL_RenderDebugText(renderer, x, y, message);
-        SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+        text.addTextCentered(message, centerX, centerY - 24.0f, 3.0f, 255, 50, 50);
 
         // Show lives remaining if not game over
         if (!gameOverPending) {
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-            SDL_SetRenderScale(renderer, 2.0f, 2.0f);
             char livesMsg[32];
             snprintf(livesMsg, sizeof(livesMsg), "Lives: %d", lives.getCount());
-            float livesWidth = strlen(livesMsg) * 8.0f;
-            SDL_RenderDebugText(renderer,
-                (DisplayManager::DESIGN_WIDTH / 2.0f - livesWidth) / 2.0f,
-                DisplayManager::DESIGN_HEIGHT / 2.0f / 2.0f + 20.0f,
-                livesMsg);
-            SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+            text.addTextCentered(livesMsg, centerX, centerY + 40.0f, 2.0f, 255, 255, 255);
         }
+        text.flush(renderer);
+        RenderStats::instance().record(1, 1);
         return;
     }
 
@@ -224,24 +345,74 @@ void PlayingScene::render(SDL_Renderer* renderer) {
     // Sky background
     SDL_SetRenderDrawColor(renderer, 100, 149, 237, 255);
     SDL_RenderClear(renderer);
+    RenderStats::instance().record(1, 1);
+
+    // Interpolate scroll between the last two ticks
+    float scrollX = prevDistanceTraveled + (distanceTraveled - prevDistanceTraveled) * renderAlpha;
 
     // Render level elements
-    renderLevel(renderer);
+    renderLevel(renderer, scrollX);
 
     // Draw player
-    player.render(renderer);
+    player.render(renderer, renderAlpha);
 
     // Draw UI (on top)
     lives.render(renderer);
     score.render(renderer);
 }
 
-void PlayingScene::renderLevel(SDL_Renderer* renderer) {
-    // Render ground segments
-    SDL_SetRenderDrawColor(renderer, 34, 139, 34, 255);  // Forest green
-    for (const auto& seg : level.getGround()) {
-        float screenStartX = seg.startX - distanceTraveled;
-        float screenEndX = seg.endX - distanceTraveled;
+void PlayingScene::renderLevel(SDL_Renderer* renderer, float scrollX) {
+    PROFILE_SCOPE("PlayingScene::renderLevel");
+    // Static geometry comes from pre-rendered tiles when the cache is on,
+    // otherwise it goes into the batch with everything else
+    bool cached = tileCacheEnabled &&
+        tileCache.render(renderer, scrollX, DisplayManager::DESIGN_WIDTH, DisplayManager::DESIGN_HEIGHT,
+                         level.getRevision(), [this](SDL_Renderer* target, float tileX) {
+            batchStaticGeometry(tileX);
+            levelBatch.flush(target);
+            renderFinishLabel(target, tileX);
+        });
+    if (!cached) {
+        batchStaticGeometry(scrollX);
+    }
+
+    // Dynamic entities, only those overlapping the view
+    const float viewMinX = scrollX;
+    const float viewMaxX = scrollX + DisplayManager::DESIGN_WIDTH;
+    const float anyY = std::numeric_limits<float>::infinity();
+
+    // Treasures (uncollected, with margin for their size)
+    const auto& treasures = level.getTreasures();
+    level.findTreasuresInSpan(viewMinX - 20.0f, viewMaxX + 20.0f, queryResults);
+    for (uint32_t i : queryResults) {
+        const Treasure& treasure = treasures[i];
+        float size = 20.0f;
+        SDL_FRect rect = {treasure.x - scrollX - size/2, treasure.y - size/2, size, size};
+        levelBatch.addRect(rect, 255, 215, 0);  // Gold
+    }
+
+    // Obstacles
+    const auto& obstacles = level.getObstacles();
+    level.findObstaclesOverlapping(viewMinX, -anyY, viewMaxX, anyY, queryResults);
+    for (uint32_t i : queryResults) {
+        const Obstacle& obs = obstacles[i];
+        SDL_FRect rect = {obs.x - scrollX, obs.y, obs.width, obs.height};
+        levelBatch.addRect(rect, 200, 50, 50);  // Red
+    }
+
+    // Everything batched so far in one call, in the order added
+    levelBatch.flush(renderer);
+
+    if (!cached) {
+        renderFinishLabel(renderer, scrollX);
+    }
+}
+
+void PlayingScene::batchStaticGeometry(float originX) {
+    // Ground (merged intervals in view), clipped to the view
+    for (const auto& seg : level.findGroundInSpan(originX, originX + DisplayManager::DESIGN_WIDTH)) {
+        float screenStartX = seg.startX - originX;
+        float screenEndX = seg.endX - originX;
 
         // Only render if visible
         if (screenEndX > 0 && screenStartX < DisplayManager::DESIGN_WIDTH) {
@@ -253,45 +424,22 @@ void PlayingScene::renderLevel(SDL_Renderer* renderer) {
                 visibleEnd - visibleStart,
                 DisplayManager::DESIGN_HEIGHT - level.getGroundY()
             };
-            SDL_RenderFillRect(renderer, &rect);
-        }
-    }
-
-    // Render platforms
-    SDL_SetRenderDrawColor(renderer, 139, 90, 43, 255);  // Brown
-    for (const auto& plat : level.getPlatforms()) {
-        float screenX = plat.x - distanceTraveled;
-        if (screenX + plat.width > 0 && screenX < DisplayManager::DESIGN_WIDTH) {
-            SDL_FRect rect = {screenX, plat.y, plat.width, plat.height};
-            SDL_RenderFillRect(renderer, &rect);
+            levelBatch.addRect(rect, 34, 139, 34);  // Forest green
         }
     }
 
-    // Render treasures
-    SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255);  // Gold
-    for (const auto& treasure : level.getTreasures()) {
-        if (treasure.collected) continue;
-
-        float screenX = treasure.x - distanceTraveled;
-        if (screenX > -20 && screenX < DisplayManager::DESIGN_WIDTH + 20) {
-            float size = 20.0f;
-            SDL_FRect rect = {screenX - size/2, treasure.y - size/2, size, size};
-            SDL_RenderFillRect(renderer, &rect);
-        }
-    }
-
-    // Render obstacles
-    SDL_SetRenderDrawColor(renderer, 200, 50, 50, 255);  // Red
-    for (const auto& obs : level.getObstacles()) {
-        float screenX = obs.x - distanceTraveled;
-        if (screenX + obs.width > 0 && screenX < DisplayManager::DESIGN_WIDTH) {
-            SDL_FRect rect = {screenX, obs.y, obs.width, obs.height};
-            SDL_RenderFillRect(renderer, &rect);
-        }
+    // Platforms
+    const float anyY = std::numeric_limits<float>::infinity();
+    const auto& platforms = level.getPlatforms();
+    level.findPlatformsOverlapping(originX, -anyY, originX + DisplayManager::DESIGN_WIDTH, anyY, queryResults);
+    for (uint32_t i : queryResults) {
+        const Platform& plat = platforms[i];
+        SDL_FRect rect = {plat.x - originX, plat.y, plat.width, plat.height};
+        levelBatch.addRect(rect, 139, 90, 43);  // Brown
     }
 
-    // Render finish line (checkered flag pattern)
-    float finishScreenX = level.getLength() - distanceTraveled;
+    // Finish line (checkered flag pattern)
+    float finishScreenX = level.getLength() - originX;
     if (finishScreenX > -20 && finishScreenX < DisplayManager::DESIGN_WIDTH + 20) {
         const float flagWidth = 20.0f;
         const float squareSize = 20.0f;
@@ -299,22 +447,22 @@ void PlayingScene::renderLevel(SDL_Renderer* renderer) {
 
         for (int i = 0; i < numSquares; i++) {
             float y = i * squareSize;
+            Uint8 leftShade = (i % 2 == 0) ? 255 : 0;
+            Uint8 rightShade = 255 - leftShade;  // Opposite color
 
-            // Left column
-            SDL_SetRenderDrawColor(renderer, (i % 2 == 0) ? 255 : 0, (i % 2 == 0) ? 255 : 0, (i % 2 == 0) ? 255 : 0, 255);
             SDL_FRect left = {finishScreenX, y, flagWidth / 2, squareSize};
-            SDL_RenderFillRect(renderer, &left);
-
-            // Right column (opposite color)
-            SDL_SetRenderDrawColor(renderer, (i % 2 == 1) ? 255 : 0, (i % 2 == 1) ? 255 : 0, (i % 2 == 1) ? 255 : 0, 255);
+            levelBatch.addRect(left, leftShade, leftShade, leftShade);
             SDL_FRect right = {finishScreenX + flagWidth / 2, y, flagWidth / 2, squareSize};
-            SDL_RenderFillRect(renderer, &right);
+            levelBatch.addRect(right, rightShade, rightShade, rightShade);
         }
+    }
+}
 
-        // "FINISH" text above the flag
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);  // Yellow
-        SDL_SetRenderScale(renderer, 1.5f, 1.5f);
-        SDL_RenderDebugText(renderer, (finishScreenX - 20) / 1.5f, 60, "FINISH");
-        SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+void PlayingScene::renderFinishLabel(SDL_Renderer* renderer, float originX) {
+    // "FINISH" text above the flag; starts 20px left of it and is 72px wide
+    float finishScreenX = level.getLength() - originX;
+    if (finishScreenX > -60 && finishScreenX < DisplayManager::DESIGN_WIDTH + 20) {
+        text.addText("FINISH", finishScreenX - 20, 90, 1.5f, 255, 255, 0);  // Yellow
+        text.flush(renderer);
     }
 }
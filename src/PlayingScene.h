@@ -4,24 +4,77 @@
 #include "Lives.h"
 #include "Score.h"
 #include "Level.h"
+#include "LevelLoader.h"
+#include "RenderBatch.h"
+#include "BitmapFont.h"
+#include "LevelTileCache.h"
+#include "PerfOverlay.h"
+#include <memory>
 
 class PlayingScene : public Scene {
 public:
-    explicit PlayingScene(int levelNum = 1) : levelNumber(levelNum) {}
+    explicit PlayingScene(int levelNum = 1)
+        : levelNumber(levelNum)
+        , levelPath("assets/levels/level" + std::to_string(levelNum) + ".json") {}
+
+    // Play an arbitrary level file (tools and benchmarks)
+    explicit PlayingScene(const std::string& levelFile)
+        : levelNumber(0), levelPath(levelFile) {}
+
+    // Take over a level loaded ahead of time (see LevelIntroScene)
+    PlayingScene(int levelNum, std::unique_ptr<PreloadedLevel> preloadedLevel)
+        : levelNumber(levelNum)
+        , levelPath("assets/levels/level" + std::to_string(levelNum) + ".json")
+        , preloaded(std::move(preloadedLevel)) {}
+
+    ~PlayingScene() override {
+        if (overlay) {
+            overlay->clearLevel(&level);
+        }
+    }
+
+    // Recycled by SceneManager: the same arguments as the constructors
+    void reuse(int levelNum = 1);
+    void reuse(const std::string& levelFile);
+    void reuse(int levelNum, std::unique_ptr<PreloadedLevel> preloadedLevel);
 
     void onEnter() override;
     void onExit() override;
     void handleEvent(const SDL_Event& event) override;
     void update(float deltaTime) override;
     void render(SDL_Renderer* renderer) override;
+    void setInterpolation(float alpha) override { renderAlpha = alpha; }
+    bool isOpaque() const override { return true; }
+    void warmUp(SDL_Renderer* renderer) override { text.prepare(renderer); }
+
+    // Draw static level geometry from pre-rendered tiles (off by default)
+    static void setTileCacheEnabled(bool enabled) { tileCacheEnabled = enabled; }
+    static bool isTileCacheEnabled() { return tileCacheEnabled; }
+
+    // Progress for headless drivers (bots, tools)
+    float getPlayerWorldX() const { return PLAYER_X + distanceTraveled; }
+    bool isPlayerGrounded() const { return player.isGrounded(); }
+    int getLivesLeft() const { return lives.getCount(); }
+    bool isLevelComplete() const { return getPlayerWorldX() >= level.getLength(); }
+    const Level& getLevel() const { return level; }
+
+    // Hash of the simulation state (player, scroll, score, lives, treasures
+    // left), for checking that a replayed session repeats exactly
+    Uint32 getStateChecksum() const;
 
 private:
     void loseLife();
     void checkCollisions();
-    void renderLevel(SDL_Renderer* renderer);
+    void renderLevel(SDL_Renderer* renderer, float scrollX);
+    void batchStaticGeometry(float originX);
+    void renderFinishLabel(SDL_Renderer* renderer, float originX);
     void restartLevel();
+    void resetRun();
+    void saveHighScore();
 
     int levelNumber;
+    std::string levelPath;
+    std::unique_ptr<PreloadedLevel> preloaded;  // Consumed by onEnter()
     Level level;
     Character1 player{150.0f, 500.0f};
 
@@ -33,6 +86,8 @@ private:
 
     // Scrolling state
     float distanceTraveled = 0.0f;
+    float prevDistanceTraveled = 0.0f;  // At the start of the last tick
+    float renderAlpha = 1.0f;           // Interpolation factor for render()
 
     // Death pause state
     bool inDeathPause = false;
@@ -41,4 +96,13 @@ private:
 
     Lives lives{3};
     Score score;
+
+    PerfOverlay* overlay = nullptr;  // The context's, set on enter; shows our level
+
+    std::vector<uint32_t> queryResults;  // Scratch for level queries, reused every tick
+    RenderBatch levelBatch;              // Rebuilt every frame, storage reused
+    LevelTileCache tileCache;            // Ground, platforms and finish line
+    BitmapFont text;                     // Finish label and death messages
+
+    inline static bool tileCacheEnabled = false;
 };
@@ -0,0 +1,145 @@
+#include "Profiler.h"
+#include <cstring>
+
+void Profiler::beginFrame() {
+    endFrame();
+
+    ProfileFrame& frame = frames[currentFrame];
+    frame.start = SDL_GetPerformanceCounter();
+    frame.end = 0;
+    frame.scopeCount = 0;
+    frame.droppedScopes = 0;
+    depth = 0;
+    frameOpen = true;
+    mainThread = SDL_GetCurrentThreadID();
+}
+
+void Profiler::endFrame() {
+    if (!frameOpen) {
+        return;
+    }
+    ProfileFrame& frame = frames[currentFrame];
+    frame.end = SDL_GetPerformanceCounter();
+
+    // Anything still open ends with the frame
+    while (depth > 0) {
+        closeScope(--depth, frame.end);
+    }
+
+    frameOpen = false;
+    completedFrames++;
+    currentFrame = (currentFrame + 1) % FRAME_HISTORY;
+}
+
+const ProfileFrame& Profiler::getFrame(int age) const {
+    // currentFrame is the slot being (or about to be) recorded
+    int index = (currentFrame - 1 - age) % FRAME_HISTORY;
+    if (index < 0) {
+        index += FRAME_HISTORY;
+    }
+    return frames[index];
+}
+
+void Profiler::recordEvent(const char* name, Uint64 start, Uint64 end) {
+    SDL_ThreadID thread = SDL_GetCurrentThreadID();
+    SDL_LockSpinlock(&eventLock);
+    events[nextEvent] = {name, start, end, thread};
+    nextEvent = (nextEvent + 1) % EVENT_HISTORY;
+    recordedEvents++;
+    SDL_UnlockSpinlock(&eventLock);
+}
+
+int Profiler::getEventCount() const {
+    SDL_LockSpinlock(&eventLock);
+    int count = recordedEvents < EVENT_HISTORY ? recordedEvents : EVENT_HISTORY;
+    SDL_UnlockSpinlock(&eventLock);
+    return count;
+}
+
+ProfileEvent Profiler::getEvent(int age) const {
+    SDL_LockSpinlock(&eventLock);
+    int index = (nextEvent - 1 - age) % EVENT_HISTORY;
+    if (index < 0) {
+        index += EVENT_HISTORY;
+    }
+    ProfileEvent event = events[index];
+    SDL_UnlockSpinlock(&eventLock);
+    return event;
+}
+
+void Profiler::copyFrames(std::vector<ProfileFrame>& out) const {
+    int count = getFrameCount();
+    out.resize(count);
+    for (int i = 0; i < count; i++) {
+        out[i] = getFrame(count - 1 - i);
+    }
+}
+
+void Profiler::copyEvents(std::vector<ProfileEvent>& out) const {
+    out.resize(EVENT_HISTORY);  // Allocate outside the lock
+    SDL_LockSpinlock(&eventLock);
+    int count = recordedEvents < EVENT_HISTORY ? recordedEvents : EVENT_HISTORY;
+    int oldest = recordedEvents < EVENT_HISTORY ? 0 : nextEvent;
+    for (int i = 0; i < count; i++) {
+        out[i] = events[(oldest + i) % EVENT_HISTORY];
+    }
+    SDL_UnlockSpinlock(&eventLock);
+    out.resize(count);
+}
+
+int Profiler::findSummary(const char* name, int scopeDepth) {
+    for (int i = 0; i < summaryCount; i++) {
+        // Names are literals, so the pointer usually matches
+        if (summary[i].name == name || std::strcmp(summary[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (summaryCount == MAX_SUMMARY_SCOPES) {
+        return -1;
+    }
+    summary[summaryCount] = {name, scopeDepth, 0, 0};
+    return summaryCount++;
+}
+
+void Profiler::closeScope(int level, Uint64 end) {
+    ProfileScopeRecord& scope = frames[currentFrame].scopes[openScopes[level]];
+    scope.end = end;
+    int slot = openSummary[level];
+    if (slot >= 0) {
+        summary[slot].ticks += scope.end - scope.start;
+        summary[slot].calls++;
+    }
+}
+
+void Profiler::logSummary(int frames) const {
+    if (frames <= 0) {
+        return;
+    }
+    const double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    for (int i = 0; i < summaryCount; i++) {
+        const SummaryEntry& entry = summary[i];
+        SDL_Log("Profile: %*s%-*s %7.3fms/frame %6.1f calls/frame",
+                entry.depth * 2, "", 32 - entry.depth * 2, entry.name,
+                entry.ticks * msPerTick / frames, (double)entry.calls / frames);
+    }
+}
+
+void Profiler::resetSummary() {
+    for (int i = 0; i < summaryCount; i++) {
+        summary[i].ticks = 0;
+        summary[i].calls = 0;
+    }
+}
+
+void Profiler::clear() {
+    frameOpen = false;
+    currentFrame = 0;
+    completedFrames = 0;
+    depth = 0;
+    summaryCount = 0;
+
+    SDL_LockSpinlock(&eventLock);
+    nextEvent = 0;
+    recordedEvents = 0;
+    SDL_UnlockSpinlock(&eventLock);
+}
@@ -0,0 +1,208 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <vector>
+
+// Scope timers are compiled in unless NDEBUG is defined; build with
+// -DMYGAME_PROFILING=1 to keep them in a release build
+#ifndef MYGAME_PROFILING
+#ifdef NDEBUG
+#define MYGAME_PROFILING 0
+#else
+#define MYGAME_PROFILING 1
+#endif
+#endif
+
+// One timed scope inside a frame. Scopes are stored in the order they were
+// entered; depth gives the nesting (0 = directly inside the frame).
+struct ProfileScopeRecord {
+    const char* name;
+    Uint64 start;
+    Uint64 end;
+    int depth;
+};
+
+// Work timed outside the frame scopes, possibly on another thread
+// (level loads, file I/O)
+struct ProfileEvent {
+    const char* name;
+    Uint64 start;
+    Uint64 end;
+    SDL_ThreadID thread;
+};
+
+struct ProfileFrame {
+    static constexpr int MAX_SCOPES = 64;
+
+    Uint64 start = 0;
+    Uint64 end = 0;
+    int scopeCount = 0;
+    int droppedScopes = 0;  // Entered after the frame was full
+    ProfileScopeRecord scopes[MAX_SCOPES];
+};
+
+// Hierarchical frame profiler. Frames run from one beginFrame() to the next
+// (PerformanceMonitor::frameStart), so present and the vsync wait land in
+// the frame they belong to. Completed frames are kept in a fixed ring
+// buffer; nothing is allocated while recording.
+//
+// Per-scope totals are also summed across frames so PerformanceMonitor can
+// log a per-subsystem budget with its report. Scope names must be string
+// literals (or otherwise outlive the profiler).
+//
+// Scopes are main thread only; scopes entered outside a frame, or on
+// another thread, are ignored.
+// Events may be recorded from any thread at any time and go into a
+// separate ring buffer.
+class Profiler {
+public:
+    static constexpr int FRAME_HISTORY = 128;
+    static constexpr int EVENT_HISTORY = 256;
+    static constexpr int MAX_DEPTH = 16;
+    static constexpr int MAX_SUMMARY_SCOPES = 32;
+
+    static Profiler& instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    // Close the current frame (if any) and open the next one
+    void beginFrame();
+    void endFrame();
+    bool isFrameOpen() const { return frameOpen.load(std::memory_order_relaxed); }
+
+    // Returns a handle for endScope(), or -1 if the scope wasn't recorded
+    int beginScope(const char* name);
+    void endScope(int handle);
+
+    // Completed frames, 0 = most recent
+    int getFrameCount() const { return completedFrames < FRAME_HISTORY ? completedFrames : FRAME_HISTORY; }
+    const ProfileFrame& getFrame(int age) const;
+
+    // Thread-safe; events are kept whether or not a frame is open
+    void recordEvent(const char* name, Uint64 start, Uint64 end);
+    int getEventCount() const;
+    ProfileEvent getEvent(int age) const;  // 0 = most recent
+
+    // Copies of the history, oldest first, for exporting
+    void copyFrames(std::vector<ProfileFrame>& out) const;
+    void copyEvents(std::vector<ProfileEvent>& out) const;
+
+    // Thread that ran the latest frame
+    SDL_ThreadID getMainThread() const { return mainThread.load(std::memory_order_relaxed); }
+
+    // Per-name totals since the last resetSummary(), in first-entered order.
+    // Resetting zeroes the totals but keeps the names, so open scopes stay valid.
+    int getSummaryCount() const { return summaryCount; }
+    const char* getSummaryName(int i) const { return summary[i].name; }
+    int getSummaryDepth(int i) const { return summary[i].depth; }
+    Uint64 getSummaryTicks(int i) const { return summary[i].ticks; }
+    Uint32 getSummaryCalls(int i) const { return summary[i].calls; }
+    void logSummary(int frames) const;
+    void resetSummary();
+
+    // Drop all history (tests)
+    void clear();
+
+private:
+    Profiler() = default;
+
+    struct SummaryEntry {
+        const char* name;
+        int depth;
+        Uint64 ticks;
+        Uint32 calls;
+    };
+
+    int findSummary(const char* name, int scopeDepth);
+    void closeScope(int level, Uint64 end);
+
+    ProfileFrame frames[FRAME_HISTORY];
+    int currentFrame = 0;
+    int completedFrames = 0;
+    // Written by the main thread each frame, read by every thread that
+    // enters a scope (job workers, Simulations)
+    std::atomic<bool> frameOpen{false};
+
+    int openScopes[MAX_DEPTH];
+    int openSummary[MAX_DEPTH];  // Summary slot per open scope, -1 if full
+    int depth = 0;
+
+    SummaryEntry summary[MAX_SUMMARY_SCOPES];
+    int summaryCount = 0;
+
+    std::atomic<SDL_ThreadID> mainThread{0};
+
+    mutable SDL_SpinLock eventLock = 0;
+    ProfileEvent events[EVENT_HISTORY];
+    int nextEvent = 0;
+    int recordedEvents = 0;
+};
+
+// Times the enclosing block as a profiler scope
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : handle(Profiler::instance().beginScope(name)) {}
+    ~ProfileScope() { Profiler::instance().endScope(handle); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int handle;
+};
+
+// Times the enclosing block as a profiler event, from any thread
+class ProfileEventScope {
+public:
+    explicit ProfileEventScope(const char* name) : name(name), start(SDL_GetPerformanceCounter()) {}
+    ~ProfileEventScope() { Profiler::instance().recordEvent(name, start, SDL_GetPerformanceCounter()); }
+
+    ProfileEventScope(const ProfileEventScope&) = delete;
+    ProfileEventScope& operator=(const ProfileEventScope&) = delete;
+
+private:
+    const char* name;
+    Uint64 start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if MYGAME_PROFILING
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_EVENT(name) ProfileEventScope PROFILE_CONCAT(profileEvent, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_EVENT(name) ((void)0)
+#endif
+
+// Implementation
+inline int Profiler::beginScope(const char* name) {
+    // Job workers and Simulations on other threads run the same scoped code;
+    // leave them out
+    if (SDL_GetCurrentThreadID() != mainThread.load(std::memory_order_relaxed) ||
+        !frameOpen.load(std::memory_order_relaxed)) {
+        return -1;
+    }
+    ProfileFrame& frame = frames[currentFrame];
+    if (frame.scopeCount >= ProfileFrame::MAX_SCOPES || depth >= MAX_DEPTH) {
+        frame.droppedScopes++;
+        return -1;
+    }
+    int handle = frame.scopeCount++;
+    openScopes[depth] = handle;
+    openSummary[depth] = findSummary(name, depth);
+    frame.scopes[handle] = {name, SDL_GetPerformanceCounter(), 0, depth};
+    depth++;
+    return handle;
+}
+
+inline void Profiler::endScope(int handle) {
+    // Scopes still open when the frame was closed were ended there
+    if (handle < 0 || !frameOpen || depth == 0 || openScopes[depth - 1] != handle) {
+        return;
+    }
+    closeScope(depth - 1, SDL_GetPerformanceCounter());
+    depth--;
+}
@@ -0,0 +1,44 @@
+#include "RenderBatch.h"
+#include "RenderStats.h"
+
+void RenderBatch::addRect(const SDL_FRect& rect, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    const SDL_FColor color = {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+    const float left = rect.x;
+    const float top = rect.y;
+    const float right = rect.x + rect.w;
+    const float bottom = rect.y + rect.h;
+
+    // Two triangles per rect: 0-1-2 and 2-3-0
+    int base = static_cast<int>(vertices.size());
+    vertices.push_back({{left, top}, color, {0.0f, 0.0f}});
+    vertices.push_back({{right, top}, color, {0.0f, 0.0f}});
+    vertices.push_back({{right, bottom}, color, {0.0f, 0.0f}});
+    vertices.push_back({{left, bottom}, color, {0.0f, 0.0f}});
+
+    indices.push_back(base);
+    indices.push_back(base + 1);
+    indices.push_back(base + 2);
+    indices.push_back(base + 2);
+    indices.push_back(base + 3);
+    indices.push_back(base);
+}
+
+bool RenderBatch::flush(SDL_Renderer* renderer) {
+    if (vertices.empty()) {
+        return true;
+    }
+    bool ok = SDL_RenderGeometry(renderer, nullptr,
+                                 vertices.data(), static_cast<int>(vertices.size()),
+                                 indices.data(), static_cast<int>(indices.size()));
+    if (!ok) {
+        SDL_Log("RenderBatch: SDL_RenderGeometry failed: %s", SDL_GetError());
+    }
+    RenderStats::instance().record(1);
+    clear();
+    return ok;
+}
+
+void RenderBatch::clear() {
+    vertices.clear();
+    indices.clear();
+}
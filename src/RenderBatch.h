@@ -0,0 +1,23 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Collects solid-color rectangles and submits them all with one
+// SDL_RenderGeometry call, using vertex colors so any number of colors share
+// the call. Rectangles are drawn in the order they were added. Storage is
+// kept between frames, so a long-lived batch stops allocating once warm.
+class RenderBatch {
+public:
+    void addRect(const SDL_FRect& rect, Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);
+
+    // Draw everything added since the last flush, then clear
+    bool flush(SDL_Renderer* renderer);
+    void clear();
+
+    size_t getRectCount() const { return vertices.size() / 4; }
+    bool isEmpty() const { return vertices.empty(); }
+
+private:
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+// Per-frame render submission counters, read and reset by PerformanceMonitor.
+// Render code records what it submits to the SDL renderer:
+//   draw calls - calls that submit geometry (fill rect(s), geometry,
+//                texture copies)
+//   commands   - draw calls plus render state changes (draw color, scale)
+class RenderStats {
+public:
+    static RenderStats& instance() {
+        static RenderStats stats;
+        return stats;
+    }
+
+    void record(int drawCalls, int stateChanges = 0) {
+        frameDrawCalls += drawCalls;
+        frameCommands += drawCalls + stateChanges;
+    }
+
+    int getDrawCalls() const { return frameDrawCalls; }
+    int getCommands() const { return frameCommands; }
+
+    void reset() {
+        frameDrawCalls = 0;
+        frameCommands = 0;
+    }
+
+private:
+    RenderStats() = default;
+
+    int frameDrawCalls = 0;
+    int frameCommands = 0;
+};
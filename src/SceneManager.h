@@ -1,10 +1,18 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include "Profiler.h"
+#include "FrameActivity.h"
+#include "PerfOverlay.h"
+#include "GameContext.h"
 #include <vector>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 class Scene;
 
+// Stack of scenes; only the top one updates. The game's stack is
+// instance(); a Simulation owns another, with its own context.
 class SceneManager {
 public:
     static SceneManager& instance() {
@@ -12,23 +20,72 @@ public:
         return mgr;
     }
 
+    // Scenes it runs see context, or GameContext::global() if null
+    explicit SceneManager(GameContext* context = nullptr) : context(context) { pool.reserve(MAX_POOLED); }
+
+    SceneManager(const SceneManager&) = delete;
+    SceneManager& operator=(const SceneManager&) = delete;
+
+    GameContext& getContext() const { return context ? *context : GameContext::global(); }
+
     void push(std::unique_ptr<Scene> scene);
     void pop();
     void replace(std::unique_ptr<Scene> scene);
 
     void handleEvent(const SDL_Event& event);
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
+    void render(SDL_Renderer* renderer, float alpha = 1.0f);
 
     bool isEmpty() const { return scenes.empty() && pendingPush.empty() && !pendingReplace; }
     Scene* current() const { return scenes.empty() ? nullptr : scenes.back().get(); }
 
+    // A scene of type T. Types with a reuse() taking the same arguments as
+    // their constructor are recycled: a scene that exits goes back to a
+    // pool (one per type), and the next create() reconfigures it instead of
+    // allocating. onEnter() must then reset everything else.
+    template<typename T, typename... Args>
+    std::unique_ptr<Scene> create(Args&&... args);
+
+    // Construct a T into the pool ahead of its transition, while the
+    // current scene is idle; the next render() also warms it up. Ignored
+    // if one is already waiting or T isn't recycled.
+    template<typename T, typename... Args>
+    void prepare(Args&&... args);
+
+    int getPooledCount() const { return static_cast<int>(pool.size()); }
+    // Drop every pooled scene (tests, shutdown)
+    void clearPool() { pool.clear(); }
+
 private:
-    SceneManager() = default;
+    static constexpr size_t MAX_POOLED = 8;
+
+    // Key identifying a scene type without RTTI
+    template<typename T>
+    static const void* typeKey() {
+        static const char key = 0;
+        return &key;
+    }
+
+    // Whether T has reuse(Args...)
+    template<typename T, typename... Args>
+    struct Reusable {
+        template<typename U>
+        static auto test(int) -> decltype(std::declval<U&>().reuse(std::declval<Args>()...), std::true_type());
+        template<typename>
+        static std::false_type test(...);
+        static constexpr bool value = decltype(test<T>(0))::value;
+    };
+
+    std::unique_ptr<Scene> takePooled(const void* key);
+    void recycle(std::unique_ptr<Scene> scene);
+    void warmUpPooled(SDL_Renderer* renderer);
+
+    GameContext* context;
     std::vector<std::unique_ptr<Scene>> scenes;
     std::vector<std::unique_ptr<Scene>> pendingPush;
     int pendingPop = 0;
     std::unique_ptr<Scene> pendingReplace;
+    std::vector<std::unique_ptr<Scene>> pool;  // Exited or prepared, at most one per type
 
     void processPending();
 };
@@ -46,21 +103,47 @@ public:
     virtual void update(float deltaTime) {}
     virtual void render(SDL_Renderer* renderer) = 0;
 
-    void requestPop() { SceneManager::instance().pop(); }
+    // An opaque scene covers the whole screen, so nothing under it is
+    // rendered. Overlays (the default) are drawn over the scene below.
+    virtual bool isOpaque() const { return false; }
+
+    // Fraction (0..1) of the way from the previous simulation tick to the
+    // current one, set before render() so motion can be interpolated
+    virtual void setInterpolation(float alpha) {}
+
+    // Create GPU resources ahead of the first render (pooled scenes)
+    virtual void warmUp(SDL_Renderer* renderer) {}
+
+    // The game or simulation this scene runs in; set when it is pushed,
+    // GameContext::global() for a scene used on its own
+    GameContext& getContext() const { return context ? *context : GameContext::global(); }
+    SceneManager& getScenes() const { return *getContext().scenes; }
+    Input& getInput() const { return *getContext().input; }
+
+    void requestPop() { getScenes().pop(); }
 
     template<typename T, typename... Args>
     void requestPush(Args&&... args) {
-        SceneManager::instance().push(std::make_unique<T>(std::forward<Args>(args)...));
+        SceneManager& manager = getScenes();
+        manager.push(manager.create<T>(std::forward<Args>(args)...));
     }
 
     template<typename T, typename... Args>
     void requestReplace(Args&&... args) {
-        SceneManager::instance().replace(std::make_unique<T>(std::forward<Args>(args)...));
+        SceneManager& manager = getScenes();
+        manager.replace(manager.create<T>(std::forward<Args>(args)...));
     }
+
+private:
+    friend class SceneManager;
+    GameContext* context = nullptr;
+    const void* poolKey = nullptr;  // Set for recycled types
+    bool warm = false;
 };
 
 // Implementation
 inline void SceneManager::push(std::unique_ptr<Scene> scene) {
+    scene->context = &getContext();
     pendingPush.push_back(std::move(scene));
 }
 
@@ -69,14 +152,88 @@ inline void SceneManager::pop() {
 }
 
 inline void SceneManager::replace(std::unique_ptr<Scene> scene) {
+    scene->context = &getContext();
     pendingReplace = std::move(scene);
 }
 
+template<typename T, typename... Args>
+std::unique_ptr<Scene> SceneManager::create(Args&&... args) {
+    if constexpr (Reusable<T, Args...>::value) {
+        std::unique_ptr<Scene> scene = takePooled(typeKey<T>());
+        if (scene) {
+            static_cast<T*>(scene.get())->reuse(std::forward<Args>(args)...);
+            return scene;
+        }
+        scene = std::make_unique<T>(std::forward<Args>(args)...);
+        scene->poolKey = typeKey<T>();
+        return scene;
+    } else {
+        return std::make_unique<T>(std::forward<Args>(args)...);
+    }
+}
+
+template<typename T, typename... Args>
+void SceneManager::prepare(Args&&... args) {
+    if constexpr (Reusable<T, Args...>::value) {
+        for (const auto& pooled : pool) {
+            if (pooled->poolKey == typeKey<T>()) {
+                return;
+            }
+        }
+        PROFILE_SCOPE("SceneManager::prepare");
+        std::unique_ptr<Scene> scene = std::make_unique<T>(std::forward<Args>(args)...);
+        scene->context = &getContext();
+        scene->poolKey = typeKey<T>();
+        recycle(std::move(scene));
+    }
+}
+
+inline std::unique_ptr<Scene> SceneManager::takePooled(const void* key) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        if (pool[i]->poolKey == key) {
+            std::unique_ptr<Scene> scene = std::move(pool[i]);
+            pool.erase(pool.begin() + i);
+            return scene;
+        }
+    }
+    return nullptr;
+}
+
+inline void SceneManager::recycle(std::unique_ptr<Scene> scene) {
+    if (!scene->poolKey || pool.size() == MAX_POOLED) {
+        return;  // Not a recycled type, or no room: destroyed here
+    }
+    for (const auto& pooled : pool) {
+        if (pooled->poolKey == scene->poolKey) {
+            return;  // One spare per type is enough
+        }
+    }
+    pool.push_back(std::move(scene));
+}
+
+inline void SceneManager::warmUpPooled(SDL_Renderer* renderer) {
+    // One per frame, so a burst of prepares doesn't become a hitch itself
+    for (auto& pooled : pool) {
+        if (!pooled->warm) {
+            PROFILE_SCOPE("SceneManager::warmUp");
+            pooled->warmUp(renderer);
+            pooled->warm = true;
+            return;
+        }
+    }
+}
+
 inline void SceneManager::processPending() {
+    if (pendingReplace || pendingPop > 0 || !pendingPush.empty()) {
+        FrameActivity::instance().mark(FrameActivity::SceneTransition);
+    }
+
     // Handle replace first
     if (pendingReplace) {
+        PROFILE_SCOPE("SceneManager::replace");
         if (!scenes.empty()) {
             scenes.back()->onExit();
+            recycle(std::move(scenes.back()));
             scenes.pop_back();
         }
         pendingReplace->onEnter();
@@ -86,7 +243,9 @@ inline void SceneManager::processPending() {
 
     // Handle pops
     while (pendingPop > 0 && !scenes.empty()) {
+        PROFILE_SCOPE("SceneManager::pop");
         scenes.back()->onExit();
+        recycle(std::move(scenes.back()));
         scenes.pop_back();
         if (!scenes.empty()) {
             scenes.back()->onResume();
@@ -97,6 +256,7 @@ inline void SceneManager::processPending() {
 
     // Handle pushes
     for (auto& scene : pendingPush) {
+        PROFILE_SCOPE("SceneManager::push");
         if (!scenes.empty()) {
             scenes.back()->onPause();
         }
@@ -107,21 +267,53 @@ inline void SceneManager::processPending() {
 }
 
 inline void SceneManager::handleEvent(const SDL_Event& event) {
+    if (PerfOverlay* overlay = getContext().overlay) {
+        overlay->handleEvent(event);
+    }
     if (!scenes.empty()) {
         scenes.back()->handleEvent(event);
     }
 }
 
 inline void SceneManager::update(float deltaTime) {
+    PROFILE_SCOPE("SceneManager::update");
+    PerfOverlay* overlay = getContext().overlay;
+    const bool timed = overlay && overlay->isEnabled();
+    Uint64 start = timed ? SDL_GetPerformanceCounter() : 0;
     processPending();
     if (!scenes.empty()) {
         scenes.back()->update(deltaTime);
     }
+    if (timed) {
+        overlay->addUpdateTime(SDL_GetPerformanceCounter() - start);
+    }
 }
 
-inline void SceneManager::render(SDL_Renderer* renderer) {
-    // Render all scenes (allows transparency/overlay)
-    for (auto& scene : scenes) {
-        scene->render(renderer);
+inline void SceneManager::render(SDL_Renderer* renderer, float alpha) {
+    PROFILE_SCOPE("SceneManager::render");
+    PerfOverlay* overlay = getContext().overlay;
+    const bool timed = overlay && overlay->isEnabled();
+    Uint64 start = timed ? SDL_GetPerformanceCounter() : 0;
+    // Render from the topmost opaque scene up; anything below it would be
+    // drawn over. Only the top scene updates, so the others are shown at
+    // their last tick rather than interpolated.
+    size_t first = scenes.size();
+    while (first > 0) {
+        first--;
+        if (scenes[first]->isOpaque()) {
+            break;
+        }
+    }
+    for (size_t i = first; i < scenes.size(); i++) {
+        scenes[i]->setInterpolation(i + 1 == scenes.size() ? alpha : 1.0f);
+        scenes[i]->render(renderer);
+        scenes[i]->warm = true;
+    }
+    if (renderer) {
+        warmUpPooled(renderer);
+    }
+    if (timed) {
+        overlay->addRenderTime(SDL_GetPerformanceCounter() - start);
+        overlay->render(renderer);  // Above everything
     }
 }
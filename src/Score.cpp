@@ -1,7 +1,10 @@
 #include "Score.h"
+#include "Profiler.h"
+#include "FrameActivity.h"
 #include <cstdio>
 #include <algorithm>
 #include <fstream>
+#include <cmath>
 
 void Score::add(int points) {
     value += points;
@@ -15,57 +18,68 @@ void Score::reset() {
 }
 
 void Score::loadHighScore(const std::string& filename) {
+    highScore = readHighScore(filename);
+}
+
+void Score::saveHighScore(const std::string& filename) {
+    writeHighScore(filename, highScore);
+}
+
+int Score::readHighScore(const std::string& filename) {
+    PROFILE_EVENT("Score::readHighScore");
+    FrameActivityScope activity(FrameActivity::FileIO);
+    int score = 0;
     std::ifstream file(filename, std::ios::binary);
     if (file.is_open()) {
-        file.read(reinterpret_cast<char*>(&highScore), sizeof(highScore));
+        file.read(reinterpret_cast<char*>(&score), sizeof(score));
         if (!file) {
-            highScore = 0;
+            score = 0;
         }
-        SDL_Log("Score: Loaded high score: %d", highScore);
+        SDL_Log("Score: Loaded high score: %d", score);
     } else {
-        highScore = 0;
         SDL_Log("Score: No high score file found, starting fresh");
     }
+    return score;
 }
 
-void Score::saveHighScore(const std::string& filename) {
+void Score::writeHighScore(const std::string& filename, int score) {
+    PROFILE_EVENT("Score::writeHighScore");
+    FrameActivityScope activity(FrameActivity::FileIO);
     std::ofstream file(filename, std::ios::binary);
     if (file.is_open()) {
-        file.write(reinterpret_cast<const char*>(&highScore), sizeof(highScore));
-        SDL_Log("Score: Saved high score: %d", highScore);
+        file.write(reinterpret_cast<const char*>(&score), sizeof(score));
+        SDL_Log("Score: Saved high score: %d", score);
     } else {
         SDL_Log("Score: Failed to save high score");
     }
 }
 
 void Score::render(SDL_Renderer* renderer) {
+    // Redrawn into the cached texture only when the value or scale changes;
+    // sized for the longest int so it never needs to grow
+    const float labelScale = 1.5f;
+    const float width = std::ceil(std::max(5 * 8.0f * labelScale, 11 * 8.0f * scale));
+    const float height = std::ceil(8.0f * labelScale + 4.0f + 8.0f * scale);
+    Uint64 key = static_cast<Uint32>(value);
+
+    hud.render(renderer, key, posX - width, posY, width, height,
+        [&](SDL_Renderer* target, float originX, float originY) {
+            drawHud(target, originX + width, originY);
+        });
+}
+
+void Score::drawHud(SDL_Renderer* renderer, float rightX, float topY) {
     const float labelScale = 1.5f;
     const float labelHeight = 8.0f * labelScale;
 
     // Draw "SCORE" label at top (right-aligned)
-    float labelWidth = 5 * 8.0f * labelScale;  // "SCORE" is 5 chars
-    float labelX = posX - labelWidth;
+    text.addText("SCORE", rightX - BitmapFont::measure("SCORE", labelScale), topY, labelScale, 200, 200, 200);
 
-    SDL_SetRenderScale(renderer, labelScale, labelScale);
-    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-    SDL_RenderDebugText(renderer, labelX / labelScale, posY / labelScale, "SCORE");
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
-
-    // Format score value
+    // Draw score value below label (right-aligned)
     char scoreText[32];
     snprintf(scoreText, sizeof(scoreText), "%d", value);
+    float scoreY = topY + labelHeight + 4.0f;  // Below the label with gap
+    text.addText(scoreText, rightX - BitmapFont::measure(scoreText, scale), scoreY, scale, 255, 255, 255);
 
-    // Calculate text width (8 pixels per char at scale)
-    int textLen = 0;
-    for (const char* p = scoreText; *p; p++) textLen++;
-    float textWidth = textLen * 8.0f * scale;
-
-    // Draw score value below label (right-aligned)
-    float scoreX = posX - textWidth;
-    float scoreY = posY + labelHeight + 4.0f;  // Below the label with gap
-
-    SDL_SetRenderScale(renderer, scale, scale);
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-    SDL_RenderDebugText(renderer, scoreX / scale, scoreY / scale, scoreText);
-    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    text.flush(renderer);
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include "HudTexture.h"
+#include "BitmapFont.h"
 #include <string>
 
 class Score {
@@ -11,6 +13,7 @@ public:
 
     int getValue() const { return value; }
     int getHighScore() const { return highScore; }
+    void setHighScore(int score) { highScore = score; }
 
     void setPosition(float x, float y) { posX = x; posY = y; }
     void setScale(float s) { scale = s; }
@@ -18,12 +21,24 @@ public:
     void loadHighScore(const std::string& filename = "highscore.dat");
     void saveHighScore(const std::string& filename = "highscore.dat");
 
+    // The file on its own, for jobs off the main thread; a missing or
+    // short file reads as 0
+    static int readHighScore(const std::string& filename);
+    static void writeHighScore(const std::string& filename, int score);
+
+    // Right-aligned at the position; cached, redrawn when the value changes
     void render(SDL_Renderer* renderer);
+    void releaseTextures() { hud.release(); text.release(); }
+    int getRedrawCount() const { return hud.getRedrawCount(); }
 
 private:
+    void drawHud(SDL_Renderer* renderer, float rightX, float topY);
+
     int value = 0;
     int highScore = 0;
     float posX = 700.0f;  // Top right by default
     float posY = 10.0f;
     float scale = 2.0f;
+    HudTexture hud;
+    BitmapFont text;
 };
@@ -0,0 +1,418 @@
+#include "SimdOverlap.h"
+#include <SDL3/SDL.h>
+
+// SSE2 is part of x86-64 and always compiled in there. AVX2 is compiled as a
+// separate target and only used when the CPU reports it. NEON is compiled
+// in for ARM builds that enable it (all Android arm64 and armv7 ABIs).
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_OVERLAP_SSE2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_OVERLAP_AVX2 1
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#define SIMD_OVERLAP_AVX2 1
+#define TARGET_AVX2
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SIMD_OVERLAP_NEON 1
+#include <arm_neon.h>
+#endif
+
+static bool isSkipped(const uint64_t* skip, size_t i) {
+    return skip && ((skip[i >> 6] >> (i & 63)) & 1);
+}
+
+// Skip bits for entities [i, i + lanes) as a lane mask
+static uint32_t skipMask(const uint64_t* skip, size_t i, unsigned lanes) {
+    if (!skip) {
+        return 0;
+    }
+    size_t word = i >> 6;
+    unsigned shift = static_cast<unsigned>(i & 63);
+    uint64_t bits = skip[word] >> shift;
+    if (shift + lanes > 64) {
+        bits |= skip[word + 1] << (64 - shift);
+    }
+    return static_cast<uint32_t>(bits) & ((1u << lanes) - 1);
+}
+
+// Append i + lane for each set lane. Writes unconditionally and only advances
+// on hits, so there is no branch per lane; out always has room for the group.
+static size_t emit(uint32_t mask, size_t i, unsigned lanes, uint32_t* out, size_t n) {
+    for (unsigned lane = 0; lane < lanes; lane++) {
+        out[n] = static_cast<uint32_t>(i + lane);
+        n += (mask >> lane) & 1;
+    }
+    return n;
+}
+
+// Scalar reference, also used for the tail after the last full vector.
+// Products and sums are separate statements so compilers that contract
+// a * b + c into a fused multiply-add within an expression don't round
+// differently from the vector paths.
+static size_t rectsScalar(const float* x, const float* y, const float* w, const float* h,
+                          size_t i, size_t last,
+                          float minX, float minY, float maxX, float maxY,
+                          uint32_t* out, size_t n) {
+    for (; i < last; i++) {
+        float right = x[i] + w[i];
+        float bottom = y[i] + h[i];
+        if (minX < right && maxX > x[i] && minY < bottom && maxY > y[i]) {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+static size_t circleScalar(const float* x, const float* y, const uint64_t* skip,
+                           size_t i, size_t last,
+                           float centerX, float centerY, float radiusSq,
+                           uint32_t* out, size_t n) {
+    for (; i < last; i++) {
+        float dx = centerX - x[i];
+        float dy = centerY - y[i];
+        float dx2 = dx * dx;
+        float dy2 = dy * dy;
+        float distSq = dx2 + dy2;
+        if (distSq < radiusSq && !isSkipped(skip, i)) {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+static size_t spanScalar(const float* x, const uint64_t* skip,
+                         size_t i, size_t last, float minX, float maxX,
+                         uint32_t* out, size_t n) {
+    for (; i < last; i++) {
+        if (minX < x[i] && x[i] < maxX && !isSkipped(skip, i)) {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+#if SIMD_OVERLAP_SSE2
+static size_t rectsSSE2(const float* x, const float* y, const float* w, const float* h,
+                        size_t first, size_t last,
+                        float minX, float minY, float maxX, float maxY, uint32_t* out) {
+    const __m128 vMinX = _mm_set1_ps(minX);
+    const __m128 vMinY = _mm_set1_ps(minY);
+    const __m128 vMaxX = _mm_set1_ps(maxX);
+    const __m128 vMaxY = _mm_set1_ps(maxY);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 4 <= last; i += 4) {
+        __m128 left = _mm_loadu_ps(x + i);
+        __m128 top = _mm_loadu_ps(y + i);
+        __m128 right = _mm_add_ps(left, _mm_loadu_ps(w + i));
+        __m128 bottom = _mm_add_ps(top, _mm_loadu_ps(h + i));
+        __m128 hitX = _mm_and_ps(_mm_cmplt_ps(vMinX, right), _mm_cmpgt_ps(vMaxX, left));
+        __m128 hitY = _mm_and_ps(_mm_cmplt_ps(vMinY, bottom), _mm_cmpgt_ps(vMaxY, top));
+        n = emit(static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(hitX, hitY))), i, 4, out, n);
+    }
+    return rectsScalar(x, y, w, h, i, last, minX, minY, maxX, maxY, out, n);
+}
+
+static size_t circleSSE2(const float* x, const float* y, const uint64_t* skip,
+                         size_t first, size_t last,
+                         float centerX, float centerY, float radiusSq, uint32_t* out) {
+    const __m128 vCenterX = _mm_set1_ps(centerX);
+    const __m128 vCenterY = _mm_set1_ps(centerY);
+    const __m128 vRadiusSq = _mm_set1_ps(radiusSq);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 4 <= last; i += 4) {
+        __m128 dx = _mm_sub_ps(vCenterX, _mm_loadu_ps(x + i));
+        __m128 dy = _mm_sub_ps(vCenterY, _mm_loadu_ps(y + i));
+        __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(distSq, vRadiusSq)));
+        n = emit(mask & ~skipMask(skip, i, 4), i, 4, out, n);
+    }
+    return circleScalar(x, y, skip, i, last, centerX, centerY, radiusSq, out, n);
+}
+
+static size_t spanSSE2(const float* x, const uint64_t* skip,
+                       size_t first, size_t last, float minX, float maxX, uint32_t* out) {
+    const __m128 vMinX = _mm_set1_ps(minX);
+    const __m128 vMaxX = _mm_set1_ps(maxX);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 4 <= last; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 inside = _mm_and_ps(_mm_cmplt_ps(vMinX, px), _mm_cmplt_ps(px, vMaxX));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(inside));
+        n = emit(mask & ~skipMask(skip, i, 4), i, 4, out, n);
+    }
+    return spanScalar(x, skip, i, last, minX, maxX, out, n);
+}
+#endif
+
+#if SIMD_OVERLAP_AVX2
+TARGET_AVX2
+static size_t rectsAVX2(const float* x, const float* y, const float* w, const float* h,
+                        size_t first, size_t last,
+                        float minX, float minY, float maxX, float maxY, uint32_t* out) {
+    const __m256 vMinX = _mm256_set1_ps(minX);
+    const __m256 vMinY = _mm256_set1_ps(minY);
+    const __m256 vMaxX = _mm256_set1_ps(maxX);
+    const __m256 vMaxY = _mm256_set1_ps(maxY);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 8 <= last; i += 8) {
+        __m256 left = _mm256_loadu_ps(x + i);
+        __m256 top = _mm256_loadu_ps(y + i);
+        __m256 right = _mm256_add_ps(left, _mm256_loadu_ps(w + i));
+        __m256 bottom = _mm256_add_ps(top, _mm256_loadu_ps(h + i));
+        __m256 hitX = _mm256_and_ps(_mm256_cmp_ps(vMinX, right, _CMP_LT_OQ),
+                                    _mm256_cmp_ps(vMaxX, left, _CMP_GT_OQ));
+        __m256 hitY = _mm256_and_ps(_mm256_cmp_ps(vMinY, bottom, _CMP_LT_OQ),
+                                    _mm256_cmp_ps(vMaxY, top, _CMP_GT_OQ));
+        n = emit(static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(hitX, hitY))), i, 8, out, n);
+    }
+    return rectsScalar(x, y, w, h, i, last, minX, minY, maxX, maxY, out, n);
+}
+
+TARGET_AVX2
+static size_t circleAVX2(const float* x, const float* y, const uint64_t* skip,
+                         size_t first, size_t last,
+                         float centerX, float centerY, float radiusSq, uint32_t* out) {
+    const __m256 vCenterX = _mm256_set1_ps(centerX);
+    const __m256 vCenterY = _mm256_set1_ps(centerY);
+    const __m256 vRadiusSq = _mm256_set1_ps(radiusSq);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 8 <= last; i += 8) {
+        __m256 dx = _mm256_sub_ps(vCenterX, _mm256_loadu_ps(x + i));
+        __m256 dy = _mm256_sub_ps(vCenterY, _mm256_loadu_ps(y + i));
+        __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_ps(_mm256_cmp_ps(distSq, vRadiusSq, _CMP_LT_OQ)));
+        n = emit(mask & ~skipMask(skip, i, 8), i, 8, out, n);
+    }
+    return circleScalar(x, y, skip, i, last, centerX, centerY, radiusSq, out, n);
+}
+
+TARGET_AVX2
+static size_t spanAVX2(const float* x, const uint64_t* skip,
+                       size_t first, size_t last, float minX, float maxX, uint32_t* out) {
+    const __m256 vMinX = _mm256_set1_ps(minX);
+    const __m256 vMaxX = _mm256_set1_ps(maxX);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 8 <= last; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 inside = _mm256_and_ps(_mm256_cmp_ps(vMinX, px, _CMP_LT_OQ),
+                                      _mm256_cmp_ps(px, vMaxX, _CMP_LT_OQ));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(inside));
+        n = emit(mask & ~skipMask(skip, i, 8), i, 8, out, n);
+    }
+    return spanScalar(x, skip, i, last, minX, maxX, out, n);
+}
+#endif
+
+#if SIMD_OVERLAP_NEON
+// Lane mask (bit per lane) from a NEON comparison result
+static uint32_t neonMask(uint32x4_t cmp) {
+    static const uint32_t laneBits[4] = {1, 2, 4, 8};
+    uint32x4_t bits = vandq_u32(cmp, vld1q_u32(laneBits));
+#if defined(__aarch64__)
+    return vaddvq_u32(bits);
+#else
+    uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return vget_lane_u32(vpadd_u32(sum, sum), 0);
+#endif
+}
+
+static size_t rectsNEON(const float* x, const float* y, const float* w, const float* h,
+                        size_t first, size_t last,
+                        float minX, float minY, float maxX, float maxY, uint32_t* out) {
+    const float32x4_t vMinX = vdupq_n_f32(minX);
+    const float32x4_t vMinY = vdupq_n_f32(minY);
+    const float32x4_t vMaxX = vdupq_n_f32(maxX);
+    const float32x4_t vMaxY = vdupq_n_f32(maxY);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 4 <= last; i += 4) {
+        float32x4_t left = vld1q_f32(x + i);
+        float32x4_t top = vld1q_f32(y + i);
+        float32x4_t right = vaddq_f32(left, vld1q_f32(w + i));
+        float32x4_t bottom = vaddq_f32(top, vld1q_f32(h + i));
+        uint32x4_t hitX = vandq_u32(vcltq_f32(vMinX, right), vcgtq_f32(vMaxX, left));
+        uint32x4_t hitY = vandq_u32(vcltq_f32(vMinY, bottom), vcgtq_f32(vMaxY, top));
+        n = emit(neonMask(vandq_u32(hitX, hitY)), i, 4, out, n);
+    }
+    return rectsScalar(x, y, w, h, i, last, minX, minY, maxX, maxY, out, n);
+}
+
+static size_t circleNEON(const float* x, const float* y, const uint64_t* skip,
+                         size_t first, size_t last,
+                         float centerX, float centerY, float radiusSq, uint32_t* out) {
+    const float32x4_t vCenterX = vdupq_n_f32(centerX);
+    const float32x4_t vCenterY = vdupq_n_f32(centerY);
+    const float32x4_t vRadiusSq = vdupq_n_f32(radiusSq);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 4 <= last; i += 4) {
+        float32x4_t dx = vsubq_f32(vCenterX, vld1q_f32(x + i));
+        float32x4_t dy = vsubq_f32(vCenterY, vld1q_f32(y + i));
+        // Separate multiply and add (not vmlaq/vfmaq) to match the scalar rounding
+        float32x4_t distSq = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+        uint32_t mask = neonMask(vcltq_f32(distSq, vRadiusSq));
+        n = emit(mask & ~skipMask(skip, i, 4), i, 4, out, n);
+    }
+    return circleScalar(x, y, skip, i, last, centerX, centerY, radiusSq, out, n);
+}
+
+static size_t spanNEON(const float* x, const uint64_t* skip,
+                       size_t first, size_t last, float minX, float maxX, uint32_t* out) {
+    const float32x4_t vMinX = vdupq_n_f32(minX);
+    const float32x4_t vMaxX = vdupq_n_f32(maxX);
+    size_t i = first;
+    size_t n = 0;
+    for (; i + 4 <= last; i += 4) {
+        float32x4_t px = vld1q_f32(x + i);
+        uint32_t mask = neonMask(vandq_u32(vcltq_f32(vMinX, px), vcltq_f32(px, vMaxX)));
+        n = emit(mask & ~skipMask(skip, i, 4), i, 4, out, n);
+    }
+    return spanScalar(x, skip, i, last, minX, maxX, out, n);
+}
+#endif
+
+static SimdPath detectSimdPath() {
+#if SIMD_OVERLAP_AVX2
+    if (SDL_HasAVX2()) {
+        return SimdPath::AVX2;
+    }
+#endif
+#if SIMD_OVERLAP_SSE2
+    return SimdPath::SSE2;
+#elif SIMD_OVERLAP_NEON
+    return SimdPath::NEON;
+#else
+    return SimdPath::Scalar;
+#endif
+}
+
+SimdPath getSimdPath() {
+    static const SimdPath path = detectSimdPath();
+    return path;
+}
+
+bool isSimdPathSupported(SimdPath path) {
+    switch (path) {
+        case SimdPath::Scalar:
+            return true;
+#if SIMD_OVERLAP_SSE2
+        case SimdPath::SSE2:
+            return true;
+#endif
+#if SIMD_OVERLAP_AVX2
+        case SimdPath::AVX2:
+            return SDL_HasAVX2();
+#endif
+#if SIMD_OVERLAP_NEON
+        case SimdPath::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* getSimdPathName(SimdPath path) {
+    switch (path) {
+        case SimdPath::SSE2: return "SSE2";
+        case SimdPath::AVX2: return "AVX2";
+        case SimdPath::NEON: return "NEON";
+        default: return "Scalar";
+    }
+}
+
+// Unsupported paths fall through to the scalar code
+size_t findRectsOverlapping(const float* x, const float* y, const float* w, const float* h,
+                            size_t first, size_t last,
+                            float minX, float minY, float maxX, float maxY,
+                            uint32_t* out, SimdPath path) {
+    if (first >= last) {
+        return 0;
+    }
+    switch (path) {
+#if SIMD_OVERLAP_SSE2
+        case SimdPath::SSE2:
+            return rectsSSE2(x, y, w, h, first, last, minX, minY, maxX, maxY, out);
+#endif
+#if SIMD_OVERLAP_AVX2
+        case SimdPath::AVX2:
+            if (isSimdPathSupported(path)) {
+                return rectsAVX2(x, y, w, h, first, last, minX, minY, maxX, maxY, out);
+            }
+            break;
+#endif
+#if SIMD_OVERLAP_NEON
+        case SimdPath::NEON:
+            return rectsNEON(x, y, w, h, first, last, minX, minY, maxX, maxY, out);
+#endif
+        default:
+            break;
+    }
+    return rectsScalar(x, y, w, h, first, last, minX, minY, maxX, maxY, out, 0);
+}
+
+size_t findPointsInCircle(const float* x, const float* y, const uint64_t* skip,
+                          size_t first, size_t last,
+                          float centerX, float centerY, float radiusSq,
+                          uint32_t* out, SimdPath path) {
+    if (first >= last) {
+        return 0;
+    }
+    switch (path) {
+#if SIMD_OVERLAP_SSE2
+        case SimdPath::SSE2:
+            return circleSSE2(x, y, skip, first, last, centerX, centerY, radiusSq, out);
+#endif
+#if SIMD_OVERLAP_AVX2
+        case SimdPath::AVX2:
+            if (isSimdPathSupported(path)) {
+                return circleAVX2(x, y, skip, first, last, centerX, centerY, radiusSq, out);
+            }
+            break;
+#endif
+#if SIMD_OVERLAP_NEON
+        case SimdPath::NEON:
+            return circleNEON(x, y, skip, first, last, centerX, centerY, radiusSq, out);
+#endif
+        default:
+            break;
+    }
+    return circleScalar(x, y, skip, first, last, centerX, centerY, radiusSq, out, 0);
+}
+
+size_t findPointsInSpan(const float* x, const uint64_t* skip,
+                        size_t first, size_t last, float minX, float maxX,
+                        uint32_t* out, SimdPath path) {
+    if (first >= last) {
+        return 0;
+    }
+    switch (path) {
+#if SIMD_OVERLAP_SSE2
+        case SimdPath::SSE2:
+            return spanSSE2(x, skip, first, last, minX, maxX, out);
+#endif
+#if SIMD_OVERLAP_AVX2
+        case SimdPath::AVX2:
+            if (isSimdPathSupported(path)) {
+                return spanAVX2(x, skip, first, last, minX, maxX, out);
+            }
+            break;
+#endif
+#if SIMD_OVERLAP_NEON
+        case SimdPath::NEON:
+            return spanNEON(x, skip, first, last, minX, maxX, out);
+#endif
+        default:
+            break;
+    }
+    return spanScalar(x, skip, first, last, minX, maxX, out, 0);
+}
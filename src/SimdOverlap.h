@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Batched overlap tests over structure-of-arrays entity data (see Level).
+//
+// Each function tests entities [first, last) of the given arrays and writes
+// the indices that pass to out, in ascending order, returning how many were
+// written. out must have room for last - first indices. Every path returns
+// exactly the same indices; Scalar is the reference and works everywhere.
+
+enum class SimdPath {
+    Scalar,
+    SSE2,   // 4 entities per instruction
+    AVX2,   // 8 entities per instruction
+    NEON    // 4 entities per instruction
+};
+
+// Fastest path this build and CPU support (detected once)
+SimdPath getSimdPath();
+bool isSimdPathSupported(SimdPath path);
+const char* getSimdPathName(SimdPath path);
+
+// Rectangles overlapping the box (open intervals, so touching edges miss):
+//   minX < x + w && maxX > x && minY < y + h && maxY > y
+size_t findRectsOverlapping(const float* x, const float* y, const float* w, const float* h,
+                            size_t first, size_t last,
+                            float minX, float minY, float maxX, float maxY,
+                            uint32_t* out, SimdPath path = getSimdPath());
+
+// Points strictly inside the circle: dx * dx + dy * dy < radiusSq.
+// Points whose bit is set in skip (bit i of skip[i / 64]) are left out;
+// skip may be null.
+size_t findPointsInCircle(const float* x, const float* y, const uint64_t* skip,
+                          size_t first, size_t last,
+                          float centerX, float centerY, float radiusSq,
+                          uint32_t* out, SimdPath path = getSimdPath());
+
+// Points strictly inside the span: minX < x && x < maxX, skipping as above
+size_t findPointsInSpan(const float* x, const uint64_t* skip,
+                        size_t first, size_t last, float minX, float maxX,
+                        uint32_t* out, SimdPath path = getSimdPath());
@@ -0,0 +1,38 @@
+#pragma once
+#include "GameContext.h"
+#include "SceneManager.h"
+#include "Input.h"
+
+// An independent game instance for headless runs (benchmarks, bots): its
+// own scene stack and input, jobs run inline, no debug overlay, no
+// high-score file and no keyboard.
+//
+// Some state is still process-wide, but safe to share: FrameActivity and
+// profiler events accept reports from any thread, profiler scopes are only
+// recorded on the main thread, and RenderStats and the tile cache setting
+// are only used by render(), which a Simulation never calls. So separate
+// instances can run on separate threads.
+//
+// Scenes keep a pointer to the context, so a Simulation stays put.
+class Simulation {
+public:
+    Simulation() : scenes(&context) {
+        context.scenes = &scenes;
+        context.input = &input;
+        context.jobs = &jobs;
+    }
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    GameContext& getContext() { return context; }
+    SceneManager& getScenes() { return scenes; }
+    Input& getInput() { return input; }
+
+private:
+    // Declared first so it outlives the scenes
+    GameContext context;
+    JobSystem jobs;  // No workers: loads finish before start() returns
+    Input input;
+    SceneManager scenes;
+};
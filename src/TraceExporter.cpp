@@ -0,0 +1,139 @@
+#include "TraceExporter.h"
+#include <algorithm>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+ProfileCapture ProfileCapture::take(const Profiler& profiler) {
+    ProfileCapture capture;
+    profiler.copyFrames(capture.frames);
+    profiler.copyEvents(capture.events);
+    capture.mainThread = profiler.getMainThread();
+    capture.frequency = SDL_GetPerformanceFrequency();
+    return capture;
+}
+
+TraceExporter::TraceExporter() {
+    SDL_SetAtomicInt(&writing, 0);
+}
+
+TraceExporter::~TraceExporter() {
+    wait();
+}
+
+bool TraceExporter::capture(const Profiler& profiler, const std::string& filePath) {
+    if (isWriting()) {
+        SDL_Log("TraceExporter: Still writing %s, capture skipped", path.c_str());
+        return false;
+    }
+    wait();  // Reap the finished thread
+
+    path = filePath;
+    pending = std::make_unique<ProfileCapture>(ProfileCapture::take(profiler));
+    SDL_SetAtomicInt(&writing, 1);
+
+    thread = SDL_CreateThread(run, "TraceExporter", this);
+    if (!thread) {
+        // No worker available, write on the calling thread instead
+        SDL_Log("TraceExporter: Failed to create thread: %s", SDL_GetError());
+        run(this);
+    }
+    return true;
+}
+
+bool TraceExporter::isWriting() const {
+    return SDL_GetAtomicInt(&writing) != 0;
+}
+
+bool TraceExporter::wait() {
+    if (thread) {
+        SDL_WaitThread(thread, nullptr);
+        thread = nullptr;
+    }
+    return lastResult;
+}
+
+int SDLCALL TraceExporter::run(void* data) {
+    TraceExporter* exporter = static_cast<TraceExporter*>(data);
+    exporter->lastResult = writeFile(*exporter->pending, exporter->path);
+    exporter->pending.reset();
+    SDL_SetAtomicInt(&exporter->writing, 0);
+    return 0;
+}
+
+std::string TraceExporter::toJson(const ProfileCapture& capture) {
+    // Timestamps in microseconds from the oldest thing captured
+    Uint64 origin = 0;
+    bool haveOrigin = false;
+    for (const ProfileFrame& frame : capture.frames) {
+        if (!haveOrigin || frame.start < origin) {
+            origin = frame.start;
+            haveOrigin = true;
+        }
+    }
+    for (const ProfileEvent& event : capture.events) {
+        if (!haveOrigin || event.start < origin) {
+            origin = event.start;
+            haveOrigin = true;
+        }
+    }
+    const double usPerTick = 1000000.0 / (double)capture.frequency;
+    auto micros = [&](Uint64 ticks) { return (double)(ticks - origin) * usPerTick; };
+    auto duration = [&](Uint64 start, Uint64 end) { return end > start ? (double)(end - start) * usPerTick : 0.0; };
+
+    json events = json::array();
+    events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", 1},
+                      {"args", {{"name", "MyGame"}}}});
+    events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", capture.mainThread},
+                      {"args", {{"name", "Main"}}}});
+
+    for (const ProfileFrame& frame : capture.frames) {
+        json args = {{"scopes", frame.scopeCount}};
+        if (frame.droppedScopes > 0) {
+            args["droppedScopes"] = frame.droppedScopes;
+        }
+        events.push_back({{"name", "Frame"}, {"cat", "frame"}, {"ph", "X"},
+                          {"ts", micros(frame.start)}, {"dur", duration(frame.start, frame.end)},
+                          {"pid", 1}, {"tid", capture.mainThread}, {"args", args}});
+
+        for (int i = 0; i < frame.scopeCount; i++) {
+            const ProfileScopeRecord& scope = frame.scopes[i];
+            events.push_back({{"name", scope.name}, {"cat", "scope"}, {"ph", "X"},
+                              {"ts", micros(scope.start)}, {"dur", duration(scope.start, scope.end)},
+                              {"pid", 1}, {"tid", capture.mainThread}});
+        }
+    }
+
+    std::vector<SDL_ThreadID> workers;
+    for (const ProfileEvent& event : capture.events) {
+        if (event.thread != capture.mainThread &&
+            std::find(workers.begin(), workers.end(), event.thread) == workers.end()) {
+            workers.push_back(event.thread);
+            events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", event.thread},
+                              {"args", {{"name", "Worker"}}}});
+        }
+        events.push_back({{"name", event.name}, {"cat", "event"}, {"ph", "X"},
+                          {"ts", micros(event.start)}, {"dur", duration(event.start, event.end)},
+                          {"pid", 1}, {"tid", event.thread}});
+    }
+
+    json trace = {{"traceEvents", events}, {"displayTimeUnit", "ms"}};
+    return trace.dump();
+}
+
+bool TraceExporter::writeFile(const ProfileCapture& capture, const std::string& filePath) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("TraceExporter: Failed to open %s", filePath.c_str());
+        return false;
+    }
+    file << toJson(capture);
+    if (!file) {
+        SDL_Log("TraceExporter: Failed to write %s", filePath.c_str());
+        return false;
+    }
+    SDL_Log("TraceExporter: Wrote %d frames and %d events to %s",
+            (int)capture.frames.size(), (int)capture.events.size(), filePath.c_str());
+    return true;
+}
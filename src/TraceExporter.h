@@ -0,0 +1,52 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "Profiler.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// Everything a trace file is built from, copied out of the profiler
+struct ProfileCapture {
+    std::vector<ProfileFrame> frames;
+    std::vector<ProfileEvent> events;
+    SDL_ThreadID mainThread = 0;
+    Uint64 frequency = 1;
+
+    static ProfileCapture take(const Profiler& profiler);
+};
+
+// Writes profiler history as Chrome trace-event JSON, viewable in
+// chrome://tracing or ui.perfetto.dev: one track per thread, frames and
+// their nested scopes on the main thread, events on whichever thread
+// recorded them.
+//
+// capture() copies the history on the calling thread (a few hundred KB of
+// memcpy) and formats and writes the file on a worker thread, so taking a
+// trace doesn't hitch the game. The thread is joined on destruction.
+class TraceExporter {
+public:
+    TraceExporter();
+    ~TraceExporter();
+
+    TraceExporter(const TraceExporter&) = delete;
+    TraceExporter& operator=(const TraceExporter&) = delete;
+
+    // Returns false if the previous capture is still being written
+    bool capture(const Profiler& profiler, const std::string& path);
+    bool isWriting() const;
+
+    // Block until the current write (if any) finishes; returns its result
+    bool wait();
+
+    static std::string toJson(const ProfileCapture& capture);
+    static bool writeFile(const ProfileCapture& capture, const std::string& path);
+
+private:
+    static int SDLCALL run(void* data);
+
+    SDL_Thread* thread = nullptr;
+    mutable SDL_AtomicInt writing;
+    std::string path;
+    std::unique_ptr<ProfileCapture> pending;
+    bool lastResult = true;
+};
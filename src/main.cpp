@@ -8,6 +8,64 @@
 #include "PerformanceMonitor.h"
 #include "Input.h"
 #include "DisplayManager.h"
+#include "FixedTimestep.h"
+#include "PlayingScene.h"
+#include "Profiler.h"
+#include "PerfOverlay.h"
+#include "LatencyTracker.h"
+#include "JobSystem.h"
+#include "FramePacer.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Number from "<option> <value>" or the environment variable (Android has
+// no command line), else the default:
+//   --tick-rate / MYGAME_TICK_RATE  simulation ticks per second
+//   --vsync / MYGAME_VSYNC          SDL_SetRenderVSync interval (0 off, -1 adaptive)
+static float readNumberOption(int argc, char* argv[], const char* option, const char* envVar, float fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], option) == 0) {
+            return std::strtof(argv[i + 1], nullptr);
+        }
+    }
+    const char* env = SDL_getenv(envVar);
+    if (env) {
+        return std::strtof(env, nullptr);
+    }
+    return fallback;
+}
+
+// Output file from "<option> <file>" or the environment variable, empty if
+// not requested:
+//   --trace / MYGAME_TRACE              Chrome trace written on exit
+//   --frame-stats / MYGAME_FRAME_STATS  frame-time histogram JSON on exit
+//   --record-input / MYGAME_RECORD_INPUT  input recording written on exit
+//   --replay-input / MYGAME_REPLAY_INPUT  recording played back instead of input
+//   --latency-stats / MYGAME_LATENCY_STATS  input-to-present latency JSON on exit
+static std::string readPathOption(int argc, char* argv[], const char* option, const char* envVar) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], option) == 0) {
+            return argv[i + 1];
+        }
+    }
+    const char* env = SDL_getenv(envVar);
+    return env ? env : "";
+}
+
+// On/off switch from "<option>" or the environment variable set to 1:
+//   --tile-cache / MYGAME_TILE_CACHE      pre-rendered static level tiles
+//   --perf-overlay / MYGAME_PERF_OVERLAY  start with the F3 overlay shown
+//   --low-latency / MYGAME_LOW_LATENCY    start frames late (FramePacer)
+static bool readFlagOption(int argc, char* argv[], const char* option, const char* envVar) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], option) == 0) {
+            return true;
+        }
+    }
+    const char* env = SDL_getenv(envVar);
+    return env && std::strcmp(env, "1") == 0;
+}
 
 int main(int argc, char* argv[]) {
     SDL_Log("Starting game...");
@@ -18,6 +76,10 @@ int main(int argc, char* argv[]) {
     }
     SDL_Log("SDL initialized");
 
+    // Workers for level loading and file I/O; the main thread helps out
+    // whenever it waits on one
+    JobSystem::instance().start(SDL_max(1, SDL_GetNumLogicalCPUCores() - 1));
+
     SDL_Window* window = SDL_CreateWindow("My Game", 800, 600, SDL_WINDOW_RESIZABLE);
     if (!window) {
         SDL_Log("SDL_CreateWindow failed: %s", SDL_GetError());
@@ -45,54 +107,157 @@ int main(int argc, char* argv[]) {
         SDL_LOGICAL_PRESENTATION_LETTERBOX);
 
     // Enable VSync for smooth rendering
-    SDL_SetRenderVSync(renderer, 1);
+    int vsync = (int)readNumberOption(argc, argv, "--vsync", "MYGAME_VSYNC", 1.0f);
+    if (!SDL_SetRenderVSync(renderer, vsync)) {
+        SDL_Log("VSync %d not supported (%s), using 1", vsync, SDL_GetError());
+        vsync = 1;
+        SDL_SetRenderVSync(renderer, vsync);
+    }
 
     // Start with intro scene
     SDL_Log("Creating scene manager...");
     SceneManager& scenes = SceneManager::instance();
     SDL_Log("Pushing intro scene...");
-    scenes.push(std::make_unique<IntroScene>());
+    scenes.push(scenes.create<IntroScene>());
     SDL_Log("Intro scene pushed");
 
     // Game loop timing
-    Uint64 lastTime = SDL_GetTicks();
+    FixedTimestep timestep(readNumberOption(argc, argv, "--tick-rate", "MYGAME_TICK_RATE",
+                                            FixedTimestep::DEFAULT_TICK_RATE));
+    SDL_Log("Simulation running at %.0f ticks/sec", timestep.getTickRate());
+    PlayingScene::setTileCacheEnabled(readFlagOption(argc, argv, "--tile-cache", "MYGAME_TILE_CACHE"));
+    if (PlayingScene::isTileCacheEnabled()) {
+        SDL_Log("Level tile cache enabled");
+    }
+    const Uint64 perfFrequency = SDL_GetPerformanceFrequency();
+    Uint64 lastTime = SDL_GetPerformanceCounter();
     FPSCounter fpsCounter;
     PerformanceMonitor perfMonitor;
+    const std::string tracePath = readPathOption(argc, argv, "--trace", "MYGAME_TRACE");
+    const std::string frameStatsPath = readPathOption(argc, argv, "--frame-stats", "MYGAME_FRAME_STATS");
+
+    // Frames longer than 1.5 refresh intervals count as missed vsync
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window));
+    if (mode && mode->refresh_rate > 0.0f) {
+        perfMonitor.setRefreshRate(mode->refresh_rate);
+    }
+    PerfOverlay::instance().setEnabled(readFlagOption(argc, argv, "--perf-overlay", "MYGAME_PERF_OVERLAY"));
+
+    // Measure how long presses take to reach the screen, and optionally
+    // shorten it by starting each frame as late as the refresh allows
+    const std::string latencyStatsPath = readPathOption(argc, argv, "--latency-stats", "MYGAME_LATENCY_STATS");
+    LatencyTracker::instance().setEnabled(!latencyStatsPath.empty());
+    FramePacer framePacer;
+    framePacer.setEnabled(readFlagOption(argc, argv, "--low-latency", "MYGAME_LOW_LATENCY"));
+    if (mode && mode->refresh_rate > 0.0f && vsync != 0) {
+        framePacer.setFrameInterval((Uint64)(1000000000.0 / mode->refresh_rate) * (Uint64)SDL_abs(vsync));
+    }
+    if (framePacer.isEnabled()) {
+        if (framePacer.getFrameInterval() == 0) {
+            SDL_Log("Low-latency mode needs vsync and a known refresh rate; off");
+        } else {
+            SDL_Log("Low-latency mode on");
+        }
+    }
+
+    // Record or replay a session. A replay has to run at the tick rate it
+    // was recorded at to repeat exactly.
+    InputRecording inputRecording;
+    const std::string recordInputPath = readPathOption(argc, argv, "--record-input", "MYGAME_RECORD_INPUT");
+    const std::string replayInputPath = readPathOption(argc, argv, "--replay-input", "MYGAME_REPLAY_INPUT");
+    if (!replayInputPath.empty() && inputRecording.load(replayInputPath)) {
+        timestep.setTickRate(inputRecording.getTickRate());
+        Input::instance().startReplay(&inputRecording);
+    } else if (!recordInputPath.empty()) {
+        inputRecording.setTickRate(timestep.getTickRate());
+        Input::instance().startRecording(&inputRecording);
+    }
+
+    Input::instance().beginFrame();
 
     bool running = true;
     while (running && !scenes.isEmpty()) {
+        framePacer.wait();
         perfMonitor.frameStart();
-        Uint64 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
+        framePacer.frameStarted(SDL_GetTicksNS());
+        Uint64 currentTime = SDL_GetPerformanceCounter();
+        float frameTime = (float)(currentTime - lastTime) / (float)perfFrequency;
         lastTime = currentTime;
 
-        // Cap delta time to avoid spiral of death
-        if (deltaTime > 0.1f) deltaTime = 0.1f;
-
         // Handle events
-        Input::instance().beginFrame();
-        SDL_Event event;
-        while (SDL_PollEvent(&event)) {
-            if (event.type == SDL_EVENT_QUIT) {
-                running = false;
-            }
-            else if (event.type == SDL_EVENT_WINDOW_RESIZED) {
-                DisplayManager::instance().handleResize(event.window.data1, event.window.data2);
+        {
+            PROFILE_SCOPE("EventPump");
+            SDL_Event event;
+            while (SDL_PollEvent(&event)) {
+                if (event.type == SDL_EVENT_QUIT) {
+                    running = false;
+                }
+                else if (event.type == SDL_EVENT_WINDOW_RESIZED) {
+                    DisplayManager::instance().handleResize(event.window.data1, event.window.data2);
+                }
+#if MYGAME_PROFILING
+                // F9 dumps the last few seconds of profiler history
+                else if (event.type == SDL_EVENT_KEY_DOWN && event.key.scancode == SDL_SCANCODE_F9 &&
+                         !event.key.repeat) {
+                    perfMonitor.captureTrace(tracePath.empty() ? "trace.json" : tracePath);
+                }
+#endif
+                Input::instance().processEvent(event);
+                scenes.handleEvent(event);
             }
-            Input::instance().processEvent(event);
-            scenes.handleEvent(event);
         }
 
-        // Update
-        fpsCounter.update(deltaTime);
-        scenes.update(deltaTime);
+        fpsCounter.update(frameTime);
 
-        // Render
-        scenes.render(renderer);
+        // Update in fixed steps; zero or several ticks may run this frame.
+        // Input edges (justPressed etc.) are consumed per tick, so a press in
+        // a frame that runs no tick is kept for the next one. Each tick is
+        // told which span of real time it simulates, so timestamped presses
+        // land at the right point inside it.
+        const Uint64 inputTimeNs = SDL_GetTicksNS();
+        int ticks = timestep.advance(frameTime);
+        for (int i = 0; i < ticks; i++) {
+            Uint64 tickStartNs = 0;
+            Uint64 tickEndNs = 0;
+            timestep.getTickWindow(inputTimeNs, i, ticks, tickStartNs, tickEndNs);
+            Input::instance().setTickWindow(tickStartNs, tickEndNs);
+            scenes.update(timestep.getStep());
+            Input::instance().beginFrame();
+        }
+
+        // Render, interpolating between the last two ticks
+        scenes.render(renderer, timestep.getAlpha());
         perfMonitor.frameEnd();
-        SDL_RenderPresent(renderer);  // VSync will handle frame timing
+        framePacer.workFinished(SDL_GetTicksNS());
+        {
+            PROFILE_SCOPE("Present");
+            SDL_RenderPresent(renderer);  // VSync will handle frame timing
+        }
+        const Uint64 presentedNs = SDL_GetTicksNS();
+        framePacer.framePresented(presentedNs);
+        LatencyTracker::instance().framePresented(presentedNs);
+    }
+
+#if MYGAME_PROFILING
+    if (!tracePath.empty()) {
+        perfMonitor.waitForTrace();  // An F9 capture may still be writing
+        perfMonitor.captureTrace(tracePath);
+    }
+#endif
+    perfMonitor.waitForTrace();
+    if (!frameStatsPath.empty()) {
+        perfMonitor.writeFrameStats(frameStatsPath);
+    }
+    if (!latencyStatsPath.empty()) {
+        LatencyTracker::instance().writeStats(latencyStatsPath);
+    }
+    if (Input::instance().isRecording()) {
+        Input::instance().stopRecording();
+        inputRecording.save(recordInputPath);
     }
 
+    scenes.clearPool();  // Pooled scenes may hold textures
+    JobSystem::instance().stop();  // Lets a high-score save land
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "BitmapFont.h"
+#include "RenderStats.h"
+#include <vector>
+
+// Software renderer drawing into a surface, so pixels can be read back
+class BitmapFontTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        surface = SDL_CreateSurface(320, 120, SDL_PIXELFORMAT_RGBA32);
+        ASSERT_NE(surface, nullptr);
+        renderer = SDL_CreateSoftwareRenderer(surface);
+        ASSERT_NE(renderer, nullptr);
+        clear();
+        RenderStats::instance().reset();
+    }
+
+    void TearDown() override {
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroySurface(surface);
+        RenderStats::instance().reset();
+    }
+
+    void clear() {
+        SDL_SetRenderDrawColor(renderer, 10, 20, 30, 255);
+        SDL_RenderClear(renderer);
+    }
+
+    std::vector<Uint8> pixels() {
+        SDL_FlushRenderer(renderer);
+        const Uint8* p = static_cast<const Uint8*>(surface->pixels);
+        return std::vector<Uint8>(p, p + surface->pitch * surface->h);
+    }
+
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* renderer = nullptr;
+};
+
+TEST_F(BitmapFontTest, MeasureIsEightPixelsPerCharacter) {
+    EXPECT_FLOAT_EQ(BitmapFont::measure("SCORE", 1.0f), 40.0f);
+    EXPECT_FLOAT_EQ(BitmapFont::measure("Press any key", 2.0f), 208.0f);
+    EXPECT_FLOAT_EQ(BitmapFont::measure("", 4.0f), 0.0f);
+}
+
+TEST_F(BitmapFontTest, SpacesAdvanceWithoutGlyphs) {
+    BitmapFont font;
+    font.addText("A B  C", 0.0f, 0.0f, 1.0f, 255, 255, 255);
+    EXPECT_EQ(font.getGlyphCount(), 3);
+    font.clear();
+    EXPECT_TRUE(font.isEmpty());
+}
+
+TEST_F(BitmapFontTest, ManyStringsShareOneDrawCall) {
+    BitmapFont font;
+    font.addText("MY GAME", 10.0f, 10.0f, 2.0f, 255, 255, 100);
+    font.addText("A Cool Adventure", 10.0f, 40.0f, 1.5f, 200, 200, 200);
+    font.addTextCentered("Press any key", 160.0f, 80.0f, 1.0f, 255, 255, 255);
+    EXPECT_EQ(font.getGlyphCount(), 6 + 14 + 11);
+
+    EXPECT_TRUE(font.flush(renderer));
+    EXPECT_EQ(RenderStats::instance().getDrawCalls(), 1);
+    EXPECT_TRUE(font.isEmpty());
+
+    // Nothing queued, nothing drawn
+    EXPECT_TRUE(font.flush(renderer));
+    EXPECT_EQ(RenderStats::instance().getDrawCalls(), 1);
+}
+
+TEST_F(BitmapFontTest, LeavesRenderScaleAlone) {
+    BitmapFont font;
+    font.addText("FINISH", 10.0f, 10.0f, 3.0f, 255, 255, 0);
+    font.flush(renderer);
+
+    float scaleX = 0.0f;
+    float scaleY = 0.0f;
+    SDL_GetRenderScale(renderer, &scaleX, &scaleY);
+    EXPECT_FLOAT_EQ(scaleX, 1.0f);
+    EXPECT_FLOAT_EQ(scaleY, 1.0f);
+}
+
+TEST_F(BitmapFontTest, MatchesDebugText) {
+    const char* text = "Hello, World! 123 ~{}";
+
+    // The old way: scaled debug text, one texture copy per glyph
+    SDL_SetRenderScale(renderer, 2.0f, 2.0f);
+    SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255);
+    SDL_RenderDebugText(renderer, 5.0f, 10.0f, text);
+    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+    std::vector<Uint8> expected = pixels();
+
+    clear();
+    BitmapFont font;
+    font.addText(text, 10.0f, 20.0f, 2.0f, 255, 215, 0);
+    ASSERT_TRUE(font.flush(renderer));
+    EXPECT_TRUE(expected == pixels());
+}
+
+TEST_F(BitmapFontTest, CopyStartsEmpty) {
+    BitmapFont font;
+    font.addText("ABC", 0.0f, 0.0f, 1.0f, 255, 255, 255);
+    BitmapFont copy(font);
+    EXPECT_TRUE(copy.isEmpty());
+    copy.addText("X", 0.0f, 0.0f, 1.0f, 255, 255, 255);
+    EXPECT_TRUE(copy.flush(renderer));
+}
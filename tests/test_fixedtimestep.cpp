@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "FixedTimestep.h"
+#include "Character1.h"
+
+TEST(FixedTimestepTest, DefaultTickRate) {
+    FixedTimestep ts;
+    EXPECT_FLOAT_EQ(ts.getTickRate(), 60.0f);
+    EXPECT_FLOAT_EQ(ts.getStep(), 1.0f / 60.0f);
+}
+
+TEST(FixedTimestepTest, TickRateIsClamped) {
+    FixedTimestep slow(1.0f);
+    EXPECT_FLOAT_EQ(slow.getTickRate(), FixedTimestep::MIN_TICK_RATE);
+
+    FixedTimestep fast(10000.0f);
+    EXPECT_FLOAT_EQ(fast.getTickRate(), FixedTimestep::MAX_TICK_RATE);
+}
+
+TEST(FixedTimestepTest, OneTickPerMatchingFrame) {
+    FixedTimestep ts(50.0f);
+    EXPECT_EQ(ts.advance(0.02f), 1);
+    EXPECT_EQ(ts.advance(0.02f), 1);
+}
+
+TEST(FixedTimestepTest, HighRefreshRateSkipsTicks) {
+    // 120 Hz display, 60 Hz simulation: every other frame runs a tick
+    FixedTimestep ts(60.0f);
+    int total = 0;
+    for (int i = 0; i < 120; i++) {
+        total += ts.advance(1.0f / 120.0f);
+    }
+    EXPECT_NEAR(total, 60, 1);
+}
+
+TEST(FixedTimestepTest, SlowFrameRunsCatchUpTicks) {
+    FixedTimestep ts(60.0f);
+    EXPECT_EQ(ts.advance(3.0f / 60.0f + 0.001f), 3);
+}
+
+TEST(FixedTimestepTest, CatchUpIsLimited) {
+    FixedTimestep ts(100.0f);
+    ts.setMaxTicksPerFrame(4);
+    EXPECT_EQ(ts.advance(0.2f), 4);
+    // Backlog was dropped, not carried into the next frame
+    EXPECT_EQ(ts.advance(0.0f), 0);
+}
+
+TEST(FixedTimestepTest, LongStallIsCapped) {
+    FixedTimestep ts(10.0f);
+    EXPECT_EQ(ts.advance(5.0f), static_cast<int>(FixedTimestep::MAX_FRAME_TIME * 10.0f));
+}
+
+TEST(FixedTimestepTest, AlphaIsLeftoverFraction) {
+    FixedTimestep ts(10.0f);
+    EXPECT_EQ(ts.advance(0.125f), 1);
+    EXPECT_NEAR(ts.getAlpha(), 0.25f, 0.001f);
+}
+
+TEST(FixedTimestepTest, NegativeFrameTimeIgnored) {
+    FixedTimestep ts;
+    EXPECT_EQ(ts.advance(-1.0f), 0);
+    EXPECT_FLOAT_EQ(ts.getAlpha(), 0.0f);
+}
+
+TEST(FixedTimestepTest, SameSimulationAtDifferentFrameRates) {
+    // Gameplay result depends only on tick count, not display refresh rate
+    const int targetTicks = 30;
+    auto simulate = [targetTicks](float frameTime) {
+        FixedTimestep ts(60.0f);
+        Character1 c(0.0f, 500.0f);
+        c.landOn(500.0f);
+        c.jump();
+        int ticks = 0;
+        while (ticks < targetTicks) {
+            int n = ts.advance(frameTime);
+            for (int i = 0; i < n && ticks < targetTicks; i++) {
+                c.applyGravity(ts.getStep());
+                ticks++;
+            }
+        }
+        return c.getY();
+    };
+
+    EXPECT_FLOAT_EQ(simulate(1.0f / 60.0f), simulate(1.0f / 144.0f));
+    EXPECT_FLOAT_EQ(simulate(1.0f / 60.0f), simulate(1.0f / 30.0f));
+}
+
+TEST(FixedTimestepTest, TickWindowsCoverTheSimulatedTime) {
+    FixedTimestep timestep(100.0f);  // 10ms ticks
+    int ticks = timestep.advance(0.025f);
+    ASSERT_EQ(ticks, 2);
+
+    // 5ms left over: ticks cover 5..15ms and 15..25ms of the 25ms frame
+    const Uint64 now = 1000000000;
+    Uint64 start = 0, end = 0;
+    timestep.getTickWindow(now, 1, ticks, start, end);
+    EXPECT_NEAR((double)(now - end), 5000000.0, 1000.0);
+    EXPECT_NEAR((double)(end - start), 10000000.0, 1000.0);
+
+    Uint64 firstEnd = 0;
+    timestep.getTickWindow(now, 0, ticks, start, firstEnd);
+    EXPECT_NEAR((double)(end - firstEnd), 10000000.0, 1000.0);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "FrameHistogram.h"
+#include <nlohmann/json.hpp>
+#include <memory>
+
+TEST(FrameHistogramTest, BucketsBoundRelativeError) {
+    // Exact below 32ns
+    for (Uint64 v = 0; v < 32; v++) {
+        EXPECT_EQ(FrameHistogram::bucketUpperBound(FrameHistogram::bucketIndex(v)), v);
+    }
+
+    // Above that the bucket holding a value is within 1/32 of it
+    int previous = -1;
+    for (Uint64 v = 32; v < 600000000000ull; v = v * 17 / 16 + 1) {
+        int index = FrameHistogram::bucketIndex(v);
+        ASSERT_GE(index, previous);
+        ASSERT_LT(index, FrameHistogram::BUCKET_COUNT);
+        Uint64 upper = FrameHistogram::bucketUpperBound(index);
+        if (index < FrameHistogram::BUCKET_COUNT - 1) {
+            EXPECT_GE(upper, v);
+            EXPECT_LE(upper - v, v / 32 + 1);
+        }
+        previous = index;
+    }
+}
+
+TEST(FrameHistogramTest, Percentiles) {
+    auto histogram = std::make_unique<FrameHistogram>();
+    for (int i = 1; i <= 1000; i++) {
+        histogram->recordNanos(static_cast<Uint64>(i) * 1000000);  // 1..1000ms
+    }
+    EXPECT_EQ(histogram->getCount(), 1000u);
+    EXPECT_NEAR(histogram->getPercentileMs(50.0), 500.0f, 500.0f / 32);
+    EXPECT_NEAR(histogram->getPercentileMs(95.0), 950.0f, 950.0f / 32);
+    EXPECT_NEAR(histogram->getPercentileMs(99.0), 990.0f, 990.0f / 32);
+    EXPECT_FLOAT_EQ(histogram->getMaxMs(), 1000.0f);  // Exact, not bucketed
+    EXPECT_NEAR(histogram->getMeanMs(), 500.5f, 0.01f);
+    EXPECT_LE(histogram->getPercentileMs(100.0), histogram->getMaxMs());
+}
+
+TEST(FrameHistogramTest, MergeAddsSamples) {
+    auto low = std::make_unique<FrameHistogram>();
+    auto high = std::make_unique<FrameHistogram>();
+    for (int i = 1; i <= 500; i++) {
+        low->recordNanos(static_cast<Uint64>(i) * 1000000);
+        high->recordNanos(static_cast<Uint64>(i + 500) * 1000000);
+    }
+    high->recordNanos(2000000000ull);  // Over 1.5 vsyncs, like everything above 25ms
+    low->merge(*high);
+    EXPECT_EQ(low->getCount(), 1001u);
+    EXPECT_NEAR(low->getPercentileMs(50.0), 501.0f, 501.0f / 32);
+    EXPECT_FLOAT_EQ(low->getMaxMs(), 2000.0f);
+    EXPECT_EQ(low->getMissedVsync(), 1001u - 25u);
+}
+
+TEST(FrameHistogramTest, EmptyReportsZero) {
+    FrameHistogram histogram;
+    EXPECT_EQ(histogram.getPercentileMs(99.0), 0.0f);
+    EXPECT_EQ(histogram.getMaxMs(), 0.0f);
+    EXPECT_EQ(histogram.summary(), "n=0 p50=0.0 p95=0.0 p99=0.0 max=0.0ms missed=0");
+}
+
+TEST(FrameHistogramTest, MissedVsyncAttributedToActivity) {
+    FrameHistogram histogram(60.0f);
+    histogram.record(0.0166f);                                 // On time
+    histogram.record(0.024f, FrameActivity::FileIO);           // Late but under 1.5 intervals
+    histogram.record(0.030f, FrameActivity::SceneTransition);
+    histogram.record(0.040f, FrameActivity::LevelLoad | FrameActivity::FileIO);
+    histogram.record(0.050f);
+
+    EXPECT_EQ(histogram.getMissedVsync(), 3u);
+    EXPECT_EQ(histogram.getMissedVsyncFor(0), 1u);  // scene
+    EXPECT_EQ(histogram.getMissedVsyncFor(1), 1u);  // load
+    EXPECT_EQ(histogram.getMissedVsyncFor(2), 1u);  // io
+    EXPECT_EQ(histogram.getMissedVsyncFor(FrameActivity::FLAG_COUNT), 1u);
+    EXPECT_NE(histogram.summary().find("missed=3 (scene 1 load 1 io 1 other 1)"), std::string::npos);
+
+    // A 144Hz display has a much tighter budget
+    histogram.reset();
+    histogram.setRefreshRate(144.0f);
+    histogram.record(0.0166f);
+    EXPECT_EQ(histogram.getMissedVsync(), 1u);
+    histogram.reset();
+    EXPECT_NEAR(histogram.getVsyncIntervalMs(), 1000.0f / 144.0f, 0.001f);
+    EXPECT_EQ(histogram.getCount(), 0u);
+}
+
+TEST(FrameHistogramTest, JsonHasTheSameNumbers) {
+    FrameHistogram histogram(60.0f);
+    histogram.record(0.016f);
+    histogram.record(0.050f, FrameActivity::LevelLoad);
+
+    nlohmann::json out = nlohmann::json::parse(histogram.toJson());
+    EXPECT_EQ(out["frames"], 2);
+    EXPECT_EQ(out["missedVsync"], 1);
+    EXPECT_EQ(out["missedVsyncBy"]["load"], 1);
+    EXPECT_EQ(out["missedVsyncBy"]["other"], 0);
+    EXPECT_NEAR(out["maxMs"].get<double>(), 50.0, 0.001);
+    EXPECT_NEAR(out["p50Ms"].get<double>(), histogram.getPercentileMs(50.0), 0.001);
+}
+
+TEST(FrameActivityTest, MarksLastOneFrame) {
+    FrameActivity& activity = FrameActivity::instance();
+    activity.consume();
+
+    activity.mark(FrameActivity::SceneTransition);
+    activity.mark(FrameActivity::FileIO);
+    EXPECT_EQ(activity.consume(), (Uint32)(FrameActivity::SceneTransition | FrameActivity::FileIO));
+    EXPECT_EQ(activity.consume(), 0u);
+}
+
+TEST(FrameActivityTest, ScopesSpanFrames) {
+    FrameActivity& activity = FrameActivity::instance();
+    activity.consume();
+    {
+        FrameActivityScope load(FrameActivity::LevelLoad);
+        EXPECT_EQ(activity.consume(), (Uint32)FrameActivity::LevelLoad);
+        EXPECT_EQ(activity.consume(), (Uint32)FrameActivity::LevelLoad);
+    }
+    // The frame it finished in still counts, the next one doesn't
+    EXPECT_EQ(activity.consume(), (Uint32)FrameActivity::LevelLoad);
+    EXPECT_EQ(activity.consume(), 0u);
+}
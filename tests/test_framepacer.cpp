@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "FramePacer.h"
+
+namespace {
+    const Uint64 MS = 1000000;
+    const Uint64 INTERVAL = 16 * MS;
+}
+
+class FramePacerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pacer.setEnabled(true);
+        pacer.setFrameInterval(INTERVAL);
+    }
+
+    // A frame that starts at start, works for work and presents at presented
+    void frame(Uint64 start, Uint64 work, Uint64 presented) {
+        pacer.frameStarted(start);
+        pacer.workFinished(start + work);
+        pacer.framePresented(presented);
+    }
+
+    FramePacer pacer;
+};
+
+TEST_F(FramePacerTest, NoWaitWithoutHistory) {
+    EXPECT_EQ(pacer.getWaitNs(0), 0u);
+}
+
+TEST_F(FramePacerTest, StartsLateEnoughToFinishBeforeTheRefresh) {
+    frame(100 * MS, 3 * MS, 116 * MS);
+    // Next refresh at 132ms; 3ms of work plus the margin
+    Uint64 expected = INTERVAL - 3 * MS - FramePacer::MARGIN_NS;
+    EXPECT_EQ(pacer.getWaitNs(116 * MS), expected);
+    EXPECT_EQ(pacer.getWaitNs(118 * MS), expected - 2 * MS);
+}
+
+TEST_F(FramePacerTest, BudgetsForTheSlowestRecentFrame) {
+    frame(100 * MS, 6 * MS, 116 * MS);
+    for (int i = 1; i < FramePacer::HISTORY; i++) {
+        Uint64 start = 116 * MS + (Uint64)(i - 1) * INTERVAL;
+        frame(start, 2 * MS, start + INTERVAL);
+    }
+    EXPECT_EQ(pacer.getWorkEstimateNs(), 6 * MS);
+
+    // Once the slow frame leaves the history the estimate drops
+    frame(0, 2 * MS, 0);
+    EXPECT_EQ(pacer.getWorkEstimateNs(), 2 * MS);
+}
+
+TEST_F(FramePacerTest, NoWaitWhenWorkFillsTheInterval) {
+    frame(100 * MS, 15 * MS, 116 * MS);
+    EXPECT_EQ(pacer.getWaitNs(116 * MS), 0u);
+}
+
+TEST_F(FramePacerTest, OffWhenDisabledOrWithoutVsync) {
+    frame(100 * MS, 3 * MS, 116 * MS);
+    pacer.setFrameInterval(0);
+    EXPECT_EQ(pacer.getWaitNs(116 * MS), 0u);
+
+    pacer.setFrameInterval(INTERVAL);
+    pacer.setEnabled(false);
+    EXPECT_EQ(pacer.getWaitNs(116 * MS), 0u);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "HudTexture.h"
+#include "RenderStats.h"
+#include "Score.h"
+#include "Lives.h"
+#include <vector>
+
+// Software renderer drawing into a surface, so pixels can be read back
+class HudTextureTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        surface = SDL_CreateSurface(200, 100, SDL_PIXELFORMAT_RGBA32);
+        ASSERT_NE(surface, nullptr);
+        renderer = SDL_CreateSoftwareRenderer(surface);
+        ASSERT_NE(renderer, nullptr);
+        clear();
+        RenderStats::instance().reset();
+    }
+
+    void TearDown() override {
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroySurface(surface);
+        RenderStats::instance().reset();
+    }
+
+    void clear() {
+        SDL_SetRenderDrawColor(renderer, 10, 20, 30, 255);
+        SDL_RenderClear(renderer);
+    }
+
+    std::vector<Uint8> pixels() {
+        SDL_FlushRenderer(renderer);
+        const Uint8* p = static_cast<const Uint8*>(surface->pixels);
+        return std::vector<Uint8>(p, p + surface->pitch * surface->h);
+    }
+
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* renderer = nullptr;
+};
+
+TEST_F(HudTextureTest, RedrawsOnlyWhenKeyChanges) {
+    HudTexture hud;
+    int draws = 0;
+    auto draw = [&](SDL_Renderer*, float, float) { draws++; };
+
+    hud.render(renderer, 1, 10.0f, 10.0f, 40.0f, 20.0f, draw);
+    hud.render(renderer, 1, 10.0f, 10.0f, 40.0f, 20.0f, draw);
+    hud.render(renderer, 1, 50.0f, 10.0f, 40.0f, 20.0f, draw);  // Moving is free
+    EXPECT_EQ(draws, 1);
+
+    hud.render(renderer, 2, 10.0f, 10.0f, 40.0f, 20.0f, draw);
+    EXPECT_EQ(draws, 2);
+    EXPECT_EQ(hud.getRedrawCount(), 2);
+
+    hud.invalidate();
+    hud.render(renderer, 2, 10.0f, 10.0f, 40.0f, 20.0f, draw);
+    EXPECT_EQ(draws, 3);
+}
+
+TEST_F(HudTextureTest, CachedFrameIsOneDrawCall) {
+    HudTexture hud;
+    auto draw = [&](SDL_Renderer* target, float x, float y) {
+        SDL_FRect rect = {x, y, 10.0f, 10.0f};
+        SDL_RenderFillRect(target, &rect);
+    };
+    hud.render(renderer, 7, 0.0f, 0.0f, 10.0f, 10.0f, draw);
+    RenderStats::instance().reset();
+
+    hud.render(renderer, 7, 0.0f, 0.0f, 10.0f, 10.0f, draw);
+    EXPECT_EQ(RenderStats::instance().getDrawCalls(), 1);
+    EXPECT_EQ(RenderStats::instance().getCommands(), 1);
+}
+
+TEST_F(HudTextureTest, CopyStartsEmpty) {
+    HudTexture hud;
+    hud.render(renderer, 1, 0.0f, 0.0f, 10.0f, 10.0f, [](SDL_Renderer*, float, float) {});
+    HudTexture copy(hud);
+    EXPECT_EQ(copy.getRedrawCount(), 0);
+
+    int draws = 0;
+    copy.render(renderer, 1, 0.0f, 0.0f, 10.0f, 10.0f, [&](SDL_Renderer*, float, float) { draws++; });
+    EXPECT_EQ(draws, 1);
+}
+
+TEST_F(HudTextureTest, ScoreRedrawsOnValueChange) {
+    Score score;
+    score.setPosition(190.0f, 10.0f);
+    score.render(renderer);
+    score.render(renderer);
+    EXPECT_EQ(score.getRedrawCount(), 1);
+
+    score.add(50);
+    score.render(renderer);
+    score.render(renderer);
+    EXPECT_EQ(score.getRedrawCount(), 2);
+}
+
+TEST_F(HudTextureTest, LivesMatchDirectDrawing) {
+    Lives lives(3);
+    lives.setPosition(10.0f, 10.0f);
+    lives.loseLife();
+    lives.render(renderer);
+    std::vector<Uint8> cached = pixels();
+    EXPECT_EQ(lives.getRedrawCount(), 1);
+
+    // Two hearts with highlights and one empty slot, as drawn directly
+    clear();
+    for (int i = 0; i < 3; i++) {
+        float x = 10.0f + i * 25.0f;
+        SDL_FRect rect = {x, 10.0f, 20.0f, 20.0f};
+        if (i < 2) {
+            SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
+            SDL_RenderFillRect(renderer, &rect);
+            SDL_SetRenderDrawColor(renderer, 255, 150, 150, 255);
+            SDL_FRect highlight = {x + 2, 12.0f, 6, 6};
+            SDL_RenderFillRect(renderer, &highlight);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
+            SDL_RenderFillRect(renderer, &rect);
+        }
+    }
+    EXPECT_TRUE(cached == pixels());
+
+    lives.render(renderer);
+    EXPECT_EQ(lives.getRedrawCount(), 1);
+    lives.loseLife();
+    lives.render(renderer);
+    EXPECT_EQ(lives.getRedrawCount(), 2);
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include "Input.h"
+
+class InputTest : public ::testing::Test {
+protected:
+    void SetUp() override { input.reset(); }
+    void TearDown() override { input.reset(); }
+
+    void key(SDL_EventType type, SDL_Scancode scancode) {
+        SDL_Event event = {};
+        event.type = type;
+        event.key.scancode = scancode;
+        input.processEvent(event);
+    }
+    void press(SDL_Scancode scancode) { key(SDL_EVENT_KEY_DOWN, scancode); }
+    void release(SDL_Scancode scancode) { key(SDL_EVENT_KEY_UP, scancode); }
+
+    void pointer(SDL_EventType type) {
+        SDL_Event event = {};
+        event.type = type;
+        input.processEvent(event);
+    }
+
+    Input& input = Input::instance();
+};
+
+TEST_F(InputTest, NothingHeldAfterReset) {
+    for (int i = 0; i < Input::ACTION_COUNT; i++) {
+        Action action = static_cast<Action>(i);
+        EXPECT_FALSE(input.isHeld(action));
+        EXPECT_FALSE(input.justPressed(action));
+        EXPECT_FALSE(input.justReleased(action));
+    }
+    EXPECT_FALSE(input.anyConfirmInput());
+}
+
+TEST_F(InputTest, PressHoldRelease) {
+    input.beginFrame();
+    press(SDL_SCANCODE_LEFT);
+    EXPECT_TRUE(input.isHeld(Action::MoveLeft));
+    EXPECT_TRUE(input.justPressed(Action::MoveLeft));
+    EXPECT_FALSE(input.isHeld(Action::MoveRight));
+
+    input.beginFrame();
+    EXPECT_TRUE(input.isHeld(Action::MoveLeft));
+    EXPECT_FALSE(input.justPressed(Action::MoveLeft));
+
+    release(SDL_SCANCODE_LEFT);
+    EXPECT_FALSE(input.isHeld(Action::MoveLeft));
+    EXPECT_TRUE(input.justReleased(Action::MoveLeft));
+
+    input.beginFrame();
+    EXPECT_FALSE(input.justReleased(Action::MoveLeft));
+}
+
+TEST_F(InputTest, AlternateKeysShareAnAction) {
+    input.beginFrame();
+    press(SDL_SCANCODE_D);
+    EXPECT_TRUE(input.isHeld(Action::MoveRight));
+    release(SDL_SCANCODE_D);
+    press(SDL_SCANCODE_ESCAPE);
+    EXPECT_TRUE(input.justPressed(Action::Back));
+    press(SDL_SCANCODE_P);
+    EXPECT_TRUE(input.isHeld(Action::Pause));
+}
+
+TEST_F(InputTest, ConfirmKeysAlsoJump) {
+    input.beginFrame();
+    press(SDL_SCANCODE_SPACE);
+    EXPECT_TRUE(input.justPressed(Action::Confirm));
+    EXPECT_TRUE(input.justPressed(Action::Jump));
+    EXPECT_TRUE(input.anyConfirmInput());
+
+    release(SDL_SCANCODE_SPACE);
+    EXPECT_FALSE(input.isHeld(Action::Jump));
+
+    input.beginFrame();
+    EXPECT_FALSE(input.anyConfirmInput());
+}
+
+TEST_F(InputTest, UpAlsoJumpsButIsNotConfirm) {
+    input.beginFrame();
+    press(SDL_SCANCODE_UP);
+    EXPECT_TRUE(input.isHeld(Action::MoveUp));
+    EXPECT_TRUE(input.justPressed(Action::Jump));
+    EXPECT_FALSE(input.isHeld(Action::Confirm));
+    EXPECT_FALSE(input.anyConfirmInput());
+
+    release(SDL_SCANCODE_UP);
+    EXPECT_FALSE(input.isHeld(Action::MoveUp));
+    EXPECT_FALSE(input.isHeld(Action::Jump));
+}
+
+TEST_F(InputTest, TapConfirmsAndJumps) {
+    input.beginFrame();
+    pointer(SDL_EVENT_FINGER_DOWN);
+    EXPECT_TRUE(input.anyConfirmInput());
+    EXPECT_TRUE(input.justPressed(Action::Jump));
+    EXPECT_FALSE(input.isHeld(Action::Confirm));
+
+    pointer(SDL_EVENT_FINGER_UP);
+    EXPECT_FALSE(input.isHeld(Action::Jump));
+
+    pointer(SDL_EVENT_MOUSE_BUTTON_DOWN);
+    EXPECT_TRUE(input.isHeld(Action::Jump));
+    pointer(SDL_EVENT_MOUSE_BUTTON_UP);
+    EXPECT_FALSE(input.isHeld(Action::Jump));
+}
+
+TEST_F(InputTest, UnboundAndOutOfRangeKeysIgnored) {
+    input.beginFrame();
+    press(SDL_SCANCODE_F7);
+    press(static_cast<SDL_Scancode>(SDL_SCANCODE_COUNT + 5));
+    for (int i = 0; i < Input::ACTION_COUNT; i++) {
+        EXPECT_FALSE(input.isHeld(static_cast<Action>(i)));
+    }
+}
+
+TEST_F(InputTest, PressBetweenFramesIsKeptForNextTick) {
+    // A press in a frame that runs no tick stays a justPressed edge
+    press(SDL_SCANCODE_SPACE);
+    release(SDL_SCANCODE_SPACE);
+    press(SDL_SCANCODE_RETURN);
+    EXPECT_TRUE(input.justPressed(Action::Confirm));
+    input.beginFrame();
+    EXPECT_FALSE(input.justPressed(Action::Confirm));
+    EXPECT_TRUE(input.isHeld(Action::Confirm));
+}
+
+TEST_F(InputTest, QueuesTransitionsWithTimestamps) {
+    SDL_Event event = {};
+    event.type = SDL_EVENT_KEY_DOWN;
+    event.key.scancode = SDL_SCANCODE_UP;
+    event.common.timestamp = 5000;
+    input.processEvent(event);
+
+    event.key.repeat = true;  // Repeats aren't transitions
+    event.common.timestamp = 6000;
+    input.processEvent(event);
+
+    ASSERT_EQ(input.getQueuedEventCount(), 2);  // MoveUp and Jump
+    for (int i = 0; i < 2; i++) {
+        EXPECT_TRUE(input.getQueuedEvent(i).pressed);
+        EXPECT_EQ(input.getQueuedEvent(i).timestamp, 5000u);
+    }
+
+    event.type = SDL_EVENT_KEY_UP;
+    event.key.repeat = false;
+    event.common.timestamp = 7000;
+    input.processEvent(event);
+    ASSERT_EQ(input.getQueuedEventCount(), 4);
+    EXPECT_FALSE(input.getQueuedEvent(3).pressed);
+}
+
+TEST_F(InputTest, SecondKeyForHeldActionIsNotQueued) {
+    press(SDL_SCANCODE_LEFT);
+    press(SDL_SCANCODE_A);
+    EXPECT_EQ(input.getQueuedEventCount(), 1);
+}
+
+TEST_F(InputTest, PressIsConsumedAtItsPointInTheTick) {
+    SDL_Event event = {};
+    event.type = SDL_EVENT_FINGER_DOWN;
+    event.common.timestamp = 1250;
+    input.processEvent(event);
+
+    input.setTickWindow(1000, 2000);
+    float fraction = -1.0f;
+    ASSERT_TRUE(input.consumePress(Action::Jump, fraction));
+    EXPECT_FLOAT_EQ(fraction, 0.25f);
+    EXPECT_FALSE(input.consumePress(Action::Jump, fraction));  // Only once
+}
+
+TEST_F(InputTest, LatePressCountsFromTickStart) {
+    SDL_Event event = {};
+    event.type = SDL_EVENT_FINGER_DOWN;
+    event.common.timestamp = 500;
+    input.processEvent(event);
+
+    input.setTickWindow(1000, 2000);
+    float fraction = -1.0f;
+    ASSERT_TRUE(input.consumePress(Action::Jump, fraction));
+    EXPECT_FLOAT_EQ(fraction, 0.0f);
+}
+
+TEST_F(InputTest, FuturePressWaitsForItsTick) {
+    SDL_Event event = {};
+    event.type = SDL_EVENT_FINGER_DOWN;
+    event.common.timestamp = 2500;
+    input.processEvent(event);
+
+    float fraction = -1.0f;
+    input.setTickWindow(1000, 2000);
+    EXPECT_FALSE(input.consumePress(Action::Jump, fraction));
+    input.beginFrame();
+    EXPECT_EQ(input.getQueuedEventCount(), 1);  // Survives the tick
+
+    input.setTickWindow(2000, 3000);
+    ASSERT_TRUE(input.consumePress(Action::Jump, fraction));
+    EXPECT_FLOAT_EQ(fraction, 0.5f);
+}
+
+TEST_F(InputTest, UnusedEventsExpireWithTheirTick) {
+    SDL_Event event = {};
+    event.type = SDL_EVENT_FINGER_DOWN;
+    event.common.timestamp = 1500;
+    input.processEvent(event);
+
+    input.setTickWindow(1000, 2000);
+    input.beginFrame();
+    EXPECT_EQ(input.getQueuedEventCount(), 0);
+}
+
+TEST_F(InputTest, WithoutWindowPressesGoToNextTick) {
+    press(SDL_SCANCODE_SPACE);
+    float fraction = -1.0f;
+    ASSERT_TRUE(input.consumePress(Action::Jump, fraction));
+    EXPECT_FLOAT_EQ(fraction, 0.0f);
+    EXPECT_TRUE(input.consumePress(Action::Confirm, fraction));
+
+    press(SDL_SCANCODE_ESCAPE);
+    input.beginFrame();
+    EXPECT_EQ(input.getQueuedEventCount(), 0);
+}
+
+TEST_F(InputTest, QueueKeepsNewestWhenFull) {
+    SDL_Event event = {};
+    for (int i = 0; i < Input::EVENT_QUEUE_SIZE + 4; i++) {
+        event.type = i % 2 ? SDL_EVENT_FINGER_UP : SDL_EVENT_FINGER_DOWN;
+        event.common.timestamp = 1000 + i;
+        input.processEvent(event);
+    }
+    ASSERT_EQ(input.getQueuedEventCount(), Input::EVENT_QUEUE_SIZE);
+    EXPECT_EQ(input.getQueuedEvent(0).timestamp, 1004u);
+}
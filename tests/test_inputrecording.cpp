@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "Input.h"
+#include "InputRecording.h"
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+class InputRecordingTest : public ::testing::Test {
+protected:
+    void SetUp() override { input.reset(); }
+    void TearDown() override {
+        input.reset();
+        std::remove("test_input.rec");
+    }
+
+    // A timestamp of 0 stands in for "now"
+    void key(SDL_EventType type, SDL_Scancode scancode, Uint64 timestamp = 0) {
+        SDL_Event event = {};
+        event.type = type;
+        event.common.timestamp = timestamp;
+        event.key.scancode = scancode;
+        input.processEvent(event);
+    }
+
+    // Fixed tick windows, so sessions don't depend on how long SDL's clock
+    // has been running
+    static Uint64 tickStart(int t) { return 100000 + 16000 * (Uint64)t; }
+
+    // What a tick's update() could observe
+    struct TickView {
+        Uint32 held = 0;
+        Uint32 pressed = 0;
+        Uint32 released = 0;
+        bool confirm = false;
+        bool any = false;
+        bool jump = false;
+        float jumpFraction = 0.0f;
+
+        bool operator==(const TickView& o) const {
+            return held == o.held && pressed == o.pressed && released == o.released &&
+                   confirm == o.confirm && any == o.any && jump == o.jump && jumpFraction == o.jumpFraction;
+        }
+    };
+
+    TickView observe() {
+        TickView view;
+        for (int i = 0; i < Input::ACTION_COUNT; i++) {
+            Action action = static_cast<Action>(i);
+            view.held |= (Uint32)input.isHeld(action) << i;
+            view.pressed |= (Uint32)input.justPressed(action) << i;
+            view.released |= (Uint32)input.justReleased(action) << i;
+        }
+        view.confirm = input.anyConfirmInput();
+        view.any = input.anyInput();
+        view.jump = input.consumePress(Action::Jump, view.jumpFraction);
+        return view;
+    }
+
+    // A short session: presses between ticks, a held key, an unbound key,
+    // a tap, and a press landing partway into a tick
+    std::vector<TickView> playSession(bool live) {
+        std::vector<TickView> ticks;
+        input.beginFrame();
+        for (int t = 0; t < 40; t++) {
+            if (live) {
+                // Keys pressed between ticks land at the start of the next
+                Uint64 now = tickStart(t);
+                if (t == 3) key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_RIGHT, now);
+                if (t == 9) key(SDL_EVENT_KEY_UP, SDL_SCANCODE_RIGHT, now);
+                if (t == 5 || t == 6) key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_SPACE, now);
+                if (t == 7) key(SDL_EVENT_KEY_UP, SDL_SCANCODE_SPACE, now);
+                if (t == 12) key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_F7, now);
+                if (t == 20) {
+                    SDL_Event tap = {};
+                    tap.type = SDL_EVENT_FINGER_DOWN;
+                    tap.common.timestamp = now + 4000;
+                    input.processEvent(tap);
+                    tap.type = SDL_EVENT_FINGER_UP;
+                    input.processEvent(tap);
+                }
+            }
+            input.setTickWindow(tickStart(t), tickStart(t + 1));
+            ticks.push_back(observe());
+            input.beginFrame();
+        }
+        return ticks;
+    }
+
+    Input& input = Input::instance();
+};
+
+TEST_F(InputRecordingTest, ReplayRepeatsEveryTick) {
+    InputRecording recording;
+    input.startRecording(&recording);
+    std::vector<TickView> live = playSession(true);
+    input.stopRecording();
+    ASSERT_FALSE(recording.isEmpty());
+
+    input.reset();
+    input.startReplay(&recording);
+    std::vector<TickView> replayed = playSession(false);
+
+    ASSERT_EQ(live.size(), replayed.size());
+    for (size_t t = 0; t < live.size(); t++) {
+        EXPECT_TRUE(live[t] == replayed[t]) << "tick " << t;
+    }
+    // The tap landed a quarter of the way into its tick
+    EXPECT_TRUE(live[20].jump);
+    EXPECT_FLOAT_EQ(live[20].jumpFraction, 0.25f);
+    EXPECT_TRUE(live[12].any);
+}
+
+TEST_F(InputRecordingTest, OnlyChangesAreRecorded) {
+    InputRecording recording;
+    input.startRecording(&recording);
+    input.beginFrame();
+    key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_LEFT);
+    for (int i = 0; i < 100; i++) {
+        input.beginFrame();
+    }
+    input.stopRecording();
+
+    // Press (with its one-tick "any" flag), flag cleared, end marker
+    EXPECT_LE(recording.size(), 4u);
+    EXPECT_EQ(recording.getLastTick(), 101u);
+}
+
+TEST_F(InputRecordingTest, ReplayIgnoresLiveEventsThenResumes) {
+    InputRecording recording;
+    input.startRecording(&recording);
+    input.beginFrame();
+    input.beginFrame();
+    input.stopRecording();
+
+    input.startReplay(&recording);
+    key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_LEFT);
+    EXPECT_FALSE(input.isHeld(Action::MoveLeft));
+
+    for (int i = 0; i < 3; i++) {
+        input.beginFrame();
+    }
+    EXPECT_FALSE(input.isReplaying());
+    key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_LEFT);
+    EXPECT_TRUE(input.isHeld(Action::MoveLeft));
+}
+
+TEST_F(InputRecordingTest, SaveAndLoad) {
+    InputRecording recording;
+    recording.setTickRate(120.0f);
+    recording.add({0, InputRecording::State, 0, 5});
+    recording.add({7, InputRecording::Press, static_cast<Uint8>(Action::Jump), 1234});
+    ASSERT_TRUE(recording.save("test_input.rec"));
+
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.load("test_input.rec"));
+    EXPECT_FLOAT_EQ(loaded.getTickRate(), 120.0f);
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[1].tick, 7u);
+    EXPECT_EQ(loaded[1].kind, InputRecording::Press);
+    EXPECT_EQ(loaded[1].value, 1234);
+}
+
+TEST_F(InputRecordingTest, RejectsBadFiles) {
+    InputRecording recording;
+    EXPECT_FALSE(recording.load("missing_input.rec"));
+
+    {
+        std::ofstream file("test_input.rec", std::ios::binary);
+        file << "not a recording at all";
+    }
+    EXPECT_FALSE(recording.load("test_input.rec"));
+
+    // Header claims more records than the file holds
+    recording.add({0, InputRecording::State, 0, 1});
+    recording.add({1, InputRecording::State, 0, 0});
+    ASSERT_TRUE(recording.save("test_input.rec"));
+    {
+        std::ifstream in("test_input.rec", std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream out("test_input.rec", std::ios::binary);
+        out.write(bytes.data(), (std::streamsize)bytes.size() - 4);
+    }
+    InputRecording truncated;
+    EXPECT_FALSE(truncated.load("test_input.rec"));
+    EXPECT_TRUE(truncated.isEmpty());
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "JobSystem.h"
+#include <atomic>
+#include <vector>
+
+TEST(JobSystemTest, NoWorkersRunsInline) {
+    JobSystem jobs;
+    EXPECT_EQ(jobs.getWorkerCount(), 0);
+    int value = 0;
+    JobHandle job = jobs.run([&value] { value = 1; });
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(JobSystem::isDone(job));
+    EXPECT_EQ(jobs.getPendingCount(), 0);
+}
+
+TEST(JobSystemTest, NullHandleCountsAsDone) {
+    JobSystem jobs(2);
+    EXPECT_TRUE(JobSystem::isDone(nullptr));
+    jobs.wait(nullptr);
+
+    int value = 0;
+    jobs.wait(jobs.run([&value] { value = 1; }, {nullptr}));
+    EXPECT_EQ(value, 1);
+}
+
+TEST(JobSystemTest, RunsEveryJobOnWorkers) {
+    JobSystem jobs(3);
+    EXPECT_EQ(jobs.getWorkerCount(), 3);
+    std::atomic<int> count{0};
+    std::vector<JobHandle> handles;
+    for (int i = 0; i < 1000; i++) {
+        handles.push_back(jobs.run([&count] { count++; }));
+    }
+    JobHandle all = jobs.run([] {}, handles);
+    jobs.wait(all);
+    EXPECT_EQ(count.load(), 1000);
+    for (const JobHandle& handle : handles) {
+        EXPECT_TRUE(JobSystem::isDone(handle));
+    }
+}
+
+TEST(JobSystemTest, DependenciesRunFirst) {
+    for (int workers : {0, 3}) {
+        JobSystem jobs(workers);
+        std::atomic<int> step{0};
+        std::atomic<bool> ordered{true};
+        JobHandle a = jobs.run([&] { step++; });
+        JobHandle b = jobs.run([&] { step++; });
+        JobHandle c = jobs.run([&] { ordered = ordered && step.load() == 2; step++; }, {a, b});
+        JobHandle d = jobs.run([&] { ordered = ordered && step.load() == 3; }, {c});
+        jobs.wait(d);
+        EXPECT_TRUE(ordered.load()) << workers << " workers";
+    }
+}
+
+TEST(JobSystemTest, WaitHelpsWithQueuedJobs) {
+    // One worker kept busy: the main thread has to run the job it waits on
+    JobSystem jobs(1);
+    std::atomic<bool> release{false};
+    jobs.run([&release] {
+        while (!release.load()) {
+            SDL_Delay(1);
+        }
+    });
+    SDL_Delay(10);  // Let the worker pick it up
+
+    SDL_ThreadID waiter = SDL_GetCurrentThreadID();
+    SDL_ThreadID ranOn = 0;
+    JobHandle job = jobs.run([&ranOn] { ranOn = SDL_GetCurrentThreadID(); });
+    jobs.wait(job);
+    EXPECT_EQ(ranOn, waiter);
+    release = true;
+}
+
+TEST(JobSystemTest, NestedJobsAndWaitInsideJobs) {
+    JobSystem jobs(3);
+    std::atomic<int> leaves{0};
+    JobHandle root = jobs.run([&] {
+        std::vector<JobHandle> children;
+        for (int i = 0; i < 8; i++) {
+            children.push_back(jobs.run([&] {
+                std::vector<JobHandle> grandchildren;
+                for (int j = 0; j < 8; j++) {
+                    grandchildren.push_back(jobs.run([&leaves] { leaves++; }));
+                }
+                for (const JobHandle& g : grandchildren) {
+                    jobs.wait(g);
+                }
+            }));
+        }
+        for (const JobHandle& child : children) {
+            jobs.wait(child);
+        }
+    });
+    jobs.wait(root);
+    EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST(JobSystemTest, StopFinishesEverythingThenRunsInline) {
+    JobSystem jobs(2);
+    std::atomic<int> count{0};
+    JobHandle first = jobs.run([&count] { SDL_Delay(5); count++; });
+    jobs.run([&count] { count++; }, {first});
+    jobs.stop();
+    EXPECT_EQ(count.load(), 2);
+    EXPECT_EQ(jobs.getWorkerCount(), 0);
+    EXPECT_EQ(jobs.getPendingCount(), 0);
+
+    jobs.run([&count] { count++; });
+    EXPECT_EQ(count.load(), 3);
+
+    // And can be started again
+    jobs.start(2);
+    EXPECT_EQ(jobs.getWorkerCount(), 2);
+    jobs.wait(jobs.run([&count] { count++; }));
+    EXPECT_EQ(count.load(), 4);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "LatencyTracker.h"
+#include "Input.h"
+#include <nlohmann/json.hpp>
+
+namespace {
+    const Uint64 MS = 1000000;
+}
+
+class LatencyTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        tracker.reset();
+        tracker.setEnabled(true);
+        Input::instance().reset();
+    }
+    void TearDown() override {
+        tracker.setEnabled(false);
+        tracker.reset();
+        Input::instance().reset();
+    }
+
+    LatencyTracker& tracker = LatencyTracker::instance();
+};
+
+TEST_F(LatencyTrackerTest, SplitsAPressIntoStages) {
+    tracker.inputPolled(100 * MS, 104 * MS);
+    tracker.inputConsumed(100 * MS, 106 * MS);
+    tracker.framePresented(130 * MS);
+
+    ASSERT_EQ(tracker.getCount(), 1u);
+    EXPECT_NEAR(tracker.getHistogram(LatencyTracker::Total).getMaxMs(), 30.0f, 0.01f);
+    EXPECT_NEAR(tracker.getHistogram(LatencyTracker::Queued).getMaxMs(), 4.0f, 0.01f);
+    EXPECT_NEAR(tracker.getHistogram(LatencyTracker::Waiting).getMaxMs(), 2.0f, 0.01f);
+    EXPECT_NEAR(tracker.getHistogram(LatencyTracker::Display).getMaxMs(), 24.0f, 0.01f);
+    EXPECT_EQ(tracker.getPendingCount(), 0);
+}
+
+TEST_F(LatencyTrackerTest, WaitsForTheConsumingTick) {
+    tracker.inputPolled(100 * MS, 101 * MS);
+    tracker.framePresented(117 * MS);  // No tick used it yet
+    EXPECT_EQ(tracker.getCount(), 0u);
+    EXPECT_EQ(tracker.getPendingCount(), 1);
+
+    tracker.inputConsumed(100 * MS, 120 * MS);
+    tracker.framePresented(134 * MS);
+    EXPECT_EQ(tracker.getCount(), 1u);
+    EXPECT_NEAR(tracker.getHistogram(LatencyTracker::Total).getMaxMs(), 34.0f, 0.01f);
+}
+
+TEST_F(LatencyTrackerTest, OneEventDrivingSeveralActionsIsOnePress) {
+    tracker.inputPolled(100 * MS, 101 * MS);
+    tracker.inputPolled(100 * MS, 101 * MS);
+    EXPECT_EQ(tracker.getPendingCount(), 1);
+}
+
+TEST_F(LatencyTrackerTest, UnconsumedPressesExpire) {
+    tracker.inputPolled(100 * MS, 101 * MS);
+    tracker.framePresented(100 * MS + LatencyTracker::MAX_AGE_NS + 1);
+    EXPECT_EQ(tracker.getPendingCount(), 0);
+    EXPECT_EQ(tracker.getDropped(), 1u);
+    EXPECT_EQ(tracker.getCount(), 0u);
+}
+
+TEST_F(LatencyTrackerTest, FullTableDropsTheOldest) {
+    for (int i = 0; i <= LatencyTracker::MAX_PENDING; i++) {
+        tracker.inputPolled((Uint64)(i + 1) * MS, (Uint64)(i + 1) * MS);
+    }
+    EXPECT_EQ(tracker.getPendingCount(), LatencyTracker::MAX_PENDING);
+    EXPECT_EQ(tracker.getDropped(), 1u);
+
+    tracker.inputConsumed(1 * MS, 50 * MS);  // Already dropped
+    tracker.inputConsumed(2 * MS, 50 * MS);
+    tracker.framePresented(60 * MS);
+    EXPECT_EQ(tracker.getCount(), 1u);
+}
+
+TEST_F(LatencyTrackerTest, IgnoresEverythingWhileDisabled) {
+    tracker.setEnabled(false);
+    tracker.inputPolled(100 * MS, 101 * MS);
+    tracker.inputConsumed(100 * MS, 102 * MS);
+    tracker.framePresented(110 * MS);
+    EXPECT_EQ(tracker.getPendingCount(), 0);
+    EXPECT_EQ(tracker.getCount(), 0u);
+}
+
+TEST_F(LatencyTrackerTest, FollowsPressesThroughInput) {
+    Input& input = Input::instance();
+    input.beginFrame();
+
+    SDL_Event event = {};
+    event.type = SDL_EVENT_FINGER_DOWN;
+    event.common.timestamp = SDL_GetTicksNS();
+    input.processEvent(event);
+    EXPECT_EQ(tracker.getPendingCount(), 1);
+
+    float fraction = 0.0f;
+    ASSERT_TRUE(input.consumePress(Action::Jump, fraction));
+    tracker.framePresented(SDL_GetTicksNS());
+    EXPECT_EQ(tracker.getCount(), 1u);
+
+    // A release or a second key down for a held action is not a new press
+    event.type = SDL_EVENT_FINGER_UP;
+    input.processEvent(event);
+    SDL_Event key = {};
+    key.type = SDL_EVENT_KEY_DOWN;
+    key.key.scancode = SDL_SCANCODE_LEFT;
+    input.processEvent(key);
+    input.processEvent(key);
+    EXPECT_EQ(tracker.getPendingCount(), 1);
+}
+
+TEST_F(LatencyTrackerTest, JsonHasEveryStage) {
+    tracker.inputPolled(100 * MS, 104 * MS);
+    tracker.inputConsumed(100 * MS, 106 * MS);
+    tracker.framePresented(130 * MS);
+
+    nlohmann::json stats = nlohmann::json::parse(tracker.toJson());
+    EXPECT_EQ(stats["presses"], 1);
+    EXPECT_EQ(stats["dropped"], 0);
+    for (const char* stage : {"total", "queued", "waiting", "display"}) {
+        ASSERT_TRUE(stats.contains(stage)) << stage;
+        EXPECT_GT(stats[stage]["p50Ms"].get<float>(), 0.0f) << stage;
+    }
+    EXPECT_NEAR(stats["total"]["p50Ms"].get<float>(), 30.0f, 1.0f);
+}
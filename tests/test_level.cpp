@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include "Level.h"
+#include <cstring>
 #include <fstream>
+#include <algorithm>
+#include <vector>
+#include <iterator>
 
 class LevelTest : public ::testing::Test {
 protected:
@@ -178,13 +182,11 @@ TEST_F(ResetTest, ResetRestoresTreasures) {
     Level level;
     level.loadFromFile("test_level.json");
 
-    // Collect first treasure
-    auto& treasures = level.getTreasures();
-    treasures[0].collected = true;
-    treasures[1].collected = true;
+    level.collectTreasure(0);
+    level.collectTreasure(1);
 
-    EXPECT_TRUE(treasures[0].collected);
-    EXPECT_TRUE(treasures[1].collected);
+    EXPECT_TRUE(level.getTreasures()[0].collected);
+    EXPECT_TRUE(level.getTreasures()[1].collected);
 
     // Reset should restore treasures
     level.reset();
@@ -192,3 +194,558 @@ TEST_F(ResetTest, ResetRestoresTreasures) {
     EXPECT_FALSE(level.getTreasures()[0].collected);
     EXPECT_FALSE(level.getTreasures()[1].collected);
 }
+
+// Index tests - unsorted and overlapping data must answer like a linear scan
+class LevelIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::ofstream file("test_level_index.json");
+        file << R"({
+            "name": "Index Level",
+            "length": 3000,
+            "groundY": 500,
+            "ground": [
+                {"start": 1200, "end": 2000},
+                {"start": 0, "end": 300},
+                {"start": 250, "end": 500},
+                {"start": 2500, "end": 2400},
+                {"start": 500, "end": 520}
+            ],
+            "platforms": [
+                {"x": 800, "y": 360, "width": 300, "height": 20},
+                {"x": 300, "y": 400, "width": 100, "height": 20},
+                {"x": 850, "y": 350, "width": 50, "height": 20},
+                {"x": 100, "y": 400, "width": 600, "height": 20}
+            ]
+        })";
+        file.close();
+        level.loadFromFile("test_level_index.json");
+    }
+
+    void TearDown() override {
+        std::remove("test_level_index.json");
+    }
+
+    Level level;
+};
+
+TEST_F(LevelIndexTest, UnsortedGroundFound) {
+    EXPECT_TRUE(level.hasGroundAt(1500.0f));
+    EXPECT_TRUE(level.hasGroundAt(100.0f));
+    EXPECT_FALSE(level.hasGroundAt(1100.0f));
+    EXPECT_FALSE(level.hasGroundAt(-10.0f));
+    EXPECT_FALSE(level.hasGroundAt(2100.0f));
+}
+
+TEST_F(LevelIndexTest, OverlappingAndTouchingGroundMerged) {
+    EXPECT_TRUE(level.hasGroundAt(275.0f));
+    EXPECT_TRUE(level.hasGroundAt(500.0f));
+    EXPECT_TRUE(level.hasGroundAt(510.0f));
+    EXPECT_TRUE(level.hasGroundAt(520.0f));
+    EXPECT_FALSE(level.hasGroundAt(521.0f));
+}
+
+TEST_F(LevelIndexTest, InvertedSegmentIgnored) {
+    EXPECT_FALSE(level.hasGroundAt(2450.0f));
+}
+
+TEST_F(LevelIndexTest, GroundInSpanUsesMergedIntervals) {
+    auto ground = level.findGroundInSpan(100.0f, 1300.0f);
+    ASSERT_EQ(ground.size(), 2u);
+    EXPECT_FLOAT_EQ(ground[0].startX, 0.0f);
+    EXPECT_FLOAT_EQ(ground[0].endX, 520.0f);
+    EXPECT_FLOAT_EQ(ground[1].startX, 1200.0f);
+    EXPECT_FLOAT_EQ(ground[1].endX, 2000.0f);
+
+    // Only touching the span at an end is not overlapping it
+    EXPECT_TRUE(level.findGroundInSpan(520.0f, 1200.0f).empty());
+    EXPECT_TRUE(level.findGroundInSpan(-100.0f, 0.0f).empty());
+    EXPECT_TRUE(level.findGroundInSpan(2100.0f, 3000.0f).empty());
+    EXPECT_EQ(level.findGroundInSpan(-1000.0f, 5000.0f).size(), 2u);
+    EXPECT_EQ(level.findGroundInSpan(1500.0f, 1600.0f).size(), 1u);
+}
+
+TEST_F(LevelIndexTest, RawGroundKeepsFileOrder) {
+    const auto& ground = level.getGround();
+    ASSERT_EQ(ground.size(), 5);
+    EXPECT_FLOAT_EQ(ground[0].startX, 1200.0f);
+}
+
+TEST_F(LevelIndexTest, WidePlatformFoundFromFarLeft) {
+    // Only the 600px platform starting at x=100 covers x=650
+    EXPECT_FLOAT_EQ(level.getPlatformSurfaceAt(650.0f, 405.0f, 100.0f), 400.0f);
+}
+
+TEST_F(LevelIndexTest, OverlappingPlatformsUseFileOrder) {
+    // Both x=800 (y=360) and x=850 (y=350) cover x=875 within tolerance;
+    // the one listed first in the file wins
+    EXPECT_FLOAT_EQ(level.getPlatformSurfaceAt(875.0f, 362.0f, 100.0f), 360.0f);
+    // Only the second is in range here
+    EXPECT_FLOAT_EQ(level.getPlatformSurfaceAt(875.0f, 352.0f, 100.0f), 350.0f);
+}
+
+TEST_F(LevelIndexTest, MatchesLinearScan) {
+    for (float x = -50.0f; x < 3100.0f; x += 7.5f) {
+        bool expectedGround = false;
+        for (const auto& seg : level.getGround()) {
+            if (x >= seg.startX && x <= seg.endX) expectedGround = true;
+        }
+        EXPECT_EQ(level.hasGroundAt(x), expectedGround) << "x=" << x;
+
+        for (float y = 340.0f; y < 420.0f; y += 5.0f) {
+            float expectedY = -1.0f;
+            for (const auto& plat : level.getPlatforms()) {
+                if (x >= plat.x && x <= plat.x + plat.width &&
+                    y >= plat.y && y <= plat.y + 15.0f) {
+                    expectedY = plat.y;
+                    break;
+                }
+            }
+            EXPECT_FLOAT_EQ(level.getPlatformSurfaceAt(x, y, 100.0f), expectedY) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+// Structure-of-arrays query tests
+class EntityArraysTest : public LevelTest {};
+
+TEST_F(EntityArraysTest, ObstaclesOverlappingBox) {
+    Level level;
+    level.loadFromFile("test_level.json");
+
+    // Obstacles at x=450 (w=30) and x=900 (w=40), both y=460..500
+    std::vector<uint32_t> found;
+    level.findObstaclesOverlapping(470.0f, 436.0f, 534.0f, 500.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{0}));
+
+    // Above the obstacle
+    level.findObstaclesOverlapping(470.0f, 380.0f, 534.0f, 444.0f, found);
+    EXPECT_TRUE(found.empty());
+
+    // Between the obstacles
+    level.findObstaclesOverlapping(600.0f, 0.0f, 700.0f, 600.0f, found);
+    EXPECT_TRUE(found.empty());
+
+    // Touching the left edge is not a hit
+    level.findObstaclesOverlapping(836.0f, 436.0f, 900.0f, 500.0f, found);
+    EXPECT_TRUE(found.empty());
+
+    level.findObstaclesOverlapping(0.0f, 0.0f, 2000.0f, 600.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{0, 1}));
+}
+
+TEST_F(EntityArraysTest, MatchesLinearScan) {
+    Level level;
+    level.loadFromFile("test_level.json");
+
+    std::vector<uint32_t> found;
+    for (float minX = -100.0f; minX < 2100.0f; minX += 7.0f) {
+        float maxX = minX + 64.0f;
+        std::vector<uint32_t> expected;
+        const auto& obstacles = level.getObstacles();
+        for (size_t i = 0; i < obstacles.size(); i++) {
+            const Obstacle& o = obstacles[i];
+            if (minX < o.x + o.width && maxX > o.x && 436.0f < o.y + o.height && 500.0f > o.y) {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        level.findObstaclesOverlapping(minX, 436.0f, maxX, 500.0f, found);
+        EXPECT_EQ(found, expected) << "minX=" << minX;
+
+        expected.clear();
+        const auto& platforms = level.getPlatforms();
+        for (size_t i = 0; i < platforms.size(); i++) {
+            if (minX < platforms[i].x + platforms[i].width && maxX > platforms[i].x) {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        level.findPlatformsOverlapping(minX, 0.0f, maxX, 600.0f, found);
+        EXPECT_EQ(found, expected) << "minX=" << minX;
+    }
+}
+
+TEST_F(EntityArraysTest, TreasuresInSpan) {
+    Level level;
+    level.loadFromFile("test_level.json");
+
+    // Treasures at x=350 and x=875
+    std::vector<uint32_t> found;
+    level.findTreasuresInSpan(800.0f, 900.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{1}));
+
+    level.findTreasuresInSpan(400.0f, 800.0f, found);
+    EXPECT_TRUE(found.empty());
+}
+
+TEST_F(EntityArraysTest, CollectedTreasuresAreSkipped) {
+    Level level;
+    level.loadFromFile("test_level.json");
+
+    // Treasures at (350, 370) and (875, 320)
+    std::vector<uint32_t> found;
+    level.findTreasuresInRadius(360.0f, 370.0f, 47.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{0}));
+    level.findTreasuresInSpan(0.0f, 2000.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{0, 1}));
+
+    level.collectTreasure(0);
+    EXPECT_TRUE(level.getTreasures()[0].collected);
+    level.findTreasuresInRadius(360.0f, 370.0f, 47.0f, found);
+    EXPECT_TRUE(found.empty());
+    level.findTreasuresInSpan(0.0f, 2000.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{1}));
+
+    level.reset();
+    level.findTreasuresInRadius(360.0f, 370.0f, 47.0f, found);
+    EXPECT_EQ(found, (std::vector<uint32_t>{0}));
+}
+
+TEST_F(EntityArraysTest, CompiledLevelQueriesMatchJson) {
+    Level fromJson;
+    fromJson.loadFromFile("test_level.json");
+    fromJson.saveBinary("test_level.lvlb");
+    Level compiled;
+    ASSERT_TRUE(compiled.loadFromFile("test_level.lvlb"));
+
+    std::vector<uint32_t> expected;
+    std::vector<uint32_t> found;
+    fromJson.findObstaclesOverlapping(0.0f, 0.0f, 2000.0f, 600.0f, expected);
+    compiled.findObstaclesOverlapping(0.0f, 0.0f, 2000.0f, 600.0f, found);
+    EXPECT_EQ(found, expected);
+    fromJson.findTreasuresInRadius(875.0f, 320.0f, 10.0f, expected);
+    compiled.findTreasuresInRadius(875.0f, 320.0f, 10.0f, found);
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(found.size(), 1);
+
+    std::remove("test_level.lvlb");
+}
+
+// Streaming tests - manifest + 1000px chunks, level 5000 long
+class StreamingLevelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::ofstream manifest("test_stream.json");
+        manifest << R"({
+            "name": "Stream Level",
+            "length": 5000,
+            "groundY": 500,
+            "chunkWidth": 1000,
+            "chunkCount": 5,
+            "chunkPrefix": "test_stream_chunk"
+        })";
+        manifest.close();
+
+        // Each chunk: ground across most of it, one treasure, one obstacle;
+        // chunk 1's platform straddles into chunk 2
+        for (int i = 0; i < 5; i++) {
+            float x = i * 1000.0f;
+            std::ofstream chunk("test_stream_chunk" + std::to_string(i) + ".json");
+            chunk << "{\"ground\": [{\"start\": " << x << ", \"end\": " << x + 900 << "}],"
+                  << "\"platforms\": [{\"x\": " << x + 950 << ", \"y\": 400, \"width\": 100, \"height\": 20}],"
+                  << "\"treasures\": [{\"x\": " << x + 500 << ", \"y\": 450, \"points\": 10}],"
+                  << "\"obstacles\": [{\"x\": " << x + 700 << ", \"y\": 460, \"width\": 30, \"height\": 40}]}";
+        }
+    }
+
+    void TearDown() override {
+        std::remove("test_stream.json");
+        for (int i = 0; i < 5; i++) {
+            std::remove(("test_stream_chunk" + std::to_string(i) + ".json").c_str());
+        }
+    }
+};
+
+TEST_F(StreamingLevelTest, ManifestLoadsNoEntities) {
+    Level level;
+    EXPECT_TRUE(level.loadFromFile("test_stream.json"));
+    EXPECT_TRUE(level.isStreaming());
+    EXPECT_FLOAT_EQ(level.getLength(), 5000.0f);
+    EXPECT_EQ(level.getResidentChunkCount(), 0);
+    EXPECT_TRUE(level.getGround().empty());
+}
+
+TEST_F(StreamingLevelTest, StreamLoadsChunksAroundView) {
+    Level level;
+    level.loadFromFile("test_stream.json");
+    level.streamTo(0.0f, 800.0f);
+
+    // Chunk 0 visible, chunk 1 ahead
+    EXPECT_EQ(level.getResidentChunkCount(), 2);
+    EXPECT_EQ(level.getGround().size(), 2);
+    EXPECT_TRUE(level.hasGroundAt(100.0f));
+    EXPECT_TRUE(level.hasGroundAt(1100.0f));
+    EXPECT_FALSE(level.hasGroundAt(950.0f));
+}
+
+TEST_F(StreamingLevelTest, ChunksBehindAreEvicted) {
+    Level level;
+    level.loadFromFile("test_stream.json");
+
+    for (float x = 0.0f; x < 5000.0f; x += 100.0f) {
+        level.streamTo(x, x + 800.0f);
+        // Bounded: one behind, the view's chunks, one ahead
+        EXPECT_LE(level.getResidentChunkCount(), 4);
+    }
+
+    level.streamTo(4000.0f, 4800.0f);
+    EXPECT_FALSE(level.hasGroundAt(100.0f));
+    EXPECT_TRUE(level.hasGroundAt(4100.0f));
+}
+
+TEST_F(StreamingLevelTest, StraddlingPlatformStaysResident) {
+    Level level;
+    level.loadFromFile("test_stream.json");
+
+    // Platform from chunk 1 (x=1950-2050) while the view starts in chunk 2
+    level.streamTo(2010.0f, 2810.0f);
+    EXPECT_FLOAT_EQ(level.getPlatformSurfaceAt(2020.0f, 405.0f, 100.0f), 400.0f);
+}
+
+TEST_F(StreamingLevelTest, CollectedKeptWhileResident) {
+    Level level;
+    level.loadFromFile("test_stream.json");
+    level.streamTo(0.0f, 800.0f);
+
+    level.collectTreasure(0);  // Treasure at x=500
+
+    // Moving forward loads chunk 2 but keeps chunk 0
+    level.streamTo(1000.0f, 1800.0f);
+    ASSERT_FALSE(level.getTreasures().empty());
+    EXPECT_FLOAT_EQ(level.getTreasures()[0].x, 500.0f);
+    EXPECT_TRUE(level.getTreasures()[0].collected);
+
+    // And the queries still skip it
+    std::vector<uint32_t> found;
+    level.findTreasuresInSpan(0.0f, 1000.0f, found);
+    EXPECT_TRUE(found.empty());
+}
+
+TEST_F(StreamingLevelTest, ResetRestoresTreasures) {
+    Level level;
+    level.loadFromFile("test_stream.json");
+    level.streamTo(0.0f, 800.0f);
+    for (size_t i = 0; i < level.getTreasures().size(); i++) {
+        level.collectTreasure(i);
+    }
+
+    level.streamTo(3000.0f, 3800.0f);
+    level.reset();
+    level.streamTo(0.0f, 800.0f);
+
+    ASSERT_EQ(level.getTreasures().size(), 2);
+    EXPECT_FALSE(level.getTreasures()[0].collected);
+    EXPECT_FALSE(level.getTreasures()[1].collected);
+}
+
+TEST_F(StreamingLevelTest, BroadphaseSeesStreamedEntities) {
+    Level level;
+    level.loadFromFile("test_stream.json");
+    level.streamTo(2000.0f, 2800.0f);
+
+    std::vector<uint32_t> obstacles;
+    level.findObstaclesOverlapping(2690.0f, 0.0f, 2710.0f, 600.0f, obstacles);
+    EXPECT_EQ(obstacles.size(), 1u);
+}
+
+TEST_F(StreamingLevelTest, WholeLevelStreamToIsNoOp) {
+    std::ofstream file("test_whole.json");
+    file << R"({"length": 1000, "ground": [{"start": 0, "end": 1000}]})";
+    file.close();
+
+    Level level;
+    level.loadFromFile("test_whole.json");
+    EXPECT_FALSE(level.isStreaming());
+    level.streamTo(5000.0f, 5800.0f);
+    EXPECT_TRUE(level.hasGroundAt(10.0f));
+    std::remove("test_whole.json");
+}
+
+TEST_F(StreamingLevelTest, MissingChunkIsReported) {
+    std::remove("test_stream_chunk2.json");
+    Level level;
+    level.loadFromFile("test_stream.json");
+    level.streamTo(0.0f, 800.0f);
+    EXPECT_FALSE(level.hasMissingChunks());
+
+    // Chunk 2 comes in ahead of the view as an empty gap
+    level.streamTo(1000.0f, 1800.0f);
+    EXPECT_TRUE(level.hasMissingChunks());
+    EXPECT_TRUE(level.hasGroundAt(1100.0f));
+    EXPECT_FALSE(level.hasGroundAt(2100.0f));
+
+    level.reset();
+    EXPECT_FALSE(level.hasMissingChunks());
+}
+
+TEST_F(StreamingLevelTest, NextChunkIsPrefetchedOnJobs) {
+    JobSystem jobs(2);
+    Level level;
+    level.loadFromFile("test_stream.json");
+    level.setJobSystem(&jobs);
+    level.streamTo(0.0f, 800.0f);
+
+    // Chunk 2 was parsed by a job; once it's done the file isn't needed
+    jobs.stop();
+    std::remove("test_stream_chunk2.json");
+    level.streamTo(1000.0f, 1800.0f);
+    EXPECT_FALSE(level.hasMissingChunks());
+    EXPECT_EQ(level.getResidentChunkCount(), 3);
+    EXPECT_TRUE(level.hasGroundAt(2100.0f));
+    EXPECT_EQ(level.getTreasures().size(), 3u);
+}
+
+// Compiled (binary) level tests
+class CompiledLevelTest : public LevelTest {
+protected:
+    void TearDown() override {
+        std::remove("test_level.lvlb");
+        LevelTest::TearDown();
+    }
+};
+
+TEST_F(CompiledLevelTest, RoundTripMatchesJson) {
+    Level source;
+    ASSERT_TRUE(source.loadFromFile("test_level.json"));
+    ASSERT_TRUE(source.saveBinary("test_level.lvlb"));
+
+    Level level;
+    ASSERT_TRUE(level.loadFromFile("test_level.lvlb"));
+    EXPECT_EQ(level.getName(), "Test Level");
+    EXPECT_FLOAT_EQ(level.getLength(), 2000.0f);
+    EXPECT_FLOAT_EQ(level.getGroundY(), 500.0f);
+
+    ASSERT_EQ(level.getGround().size(), 3);
+    EXPECT_FLOAT_EQ(level.getGround()[1].startX, 600.0f);
+    ASSERT_EQ(level.getPlatforms().size(), 2);
+    EXPECT_FLOAT_EQ(level.getPlatforms()[1].width, 150.0f);
+    ASSERT_EQ(level.getTreasures().size(), 2);
+    EXPECT_EQ(level.getTreasures()[0].points, 100);
+    EXPECT_FALSE(level.getTreasures()[0].collected);
+    ASSERT_EQ(level.getObstacles().size(), 2);
+    EXPECT_FLOAT_EQ(level.getObstacles()[1].x, 900.0f);
+}
+
+TEST_F(CompiledLevelTest, QueriesMatchJson) {
+    Level source;
+    source.loadFromFile("test_level.json");
+    source.saveBinary("test_level.lvlb");
+    Level level;
+    level.loadFromFile("test_level.lvlb");
+
+    for (float x = -50.0f; x < 2100.0f; x += 5.0f) {
+        EXPECT_EQ(level.hasGroundAt(x), source.hasGroundAt(x)) << "x=" << x;
+        EXPECT_FLOAT_EQ(level.getPlatformSurfaceAt(x, 405.0f, 100.0f),
+                        source.getPlatformSurfaceAt(x, 405.0f, 100.0f)) << "x=" << x;
+    }
+
+    std::vector<uint32_t> obstacles;
+    level.findObstaclesOverlapping(470.0f, 0.0f, 520.0f, 600.0f, obstacles);
+    EXPECT_EQ(obstacles, (std::vector<uint32_t>{0}));
+}
+
+TEST_F(CompiledLevelTest, ResetRestoresTreasures) {
+    Level source;
+    source.loadFromFile("test_level.json");
+    source.saveBinary("test_level.lvlb");
+    Level level;
+    level.loadFromFile("test_level.lvlb");
+
+    level.collectTreasure(0);
+    level.reset();
+    EXPECT_FALSE(level.getTreasures()[0].collected);
+}
+
+TEST_F(CompiledLevelTest, MovedLevelKeepsData) {
+    Level source;
+    source.loadFromFile("test_level.json");
+    source.saveBinary("test_level.lvlb");
+
+    Level compiled;
+    compiled.loadFromFile("test_level.lvlb");
+    Level moved(std::move(compiled));
+    EXPECT_TRUE(moved.hasGroundAt(250.0f));
+    EXPECT_EQ(moved.getGround().size(), 3);
+
+    Level fromJson;
+    fromJson.loadFromFile("test_level.json");
+    Level movedJson(std::move(fromJson));
+    EXPECT_TRUE(movedJson.hasGroundAt(250.0f));
+    EXPECT_FALSE(movedJson.hasGroundAt(550.0f));
+}
+
+TEST_F(CompiledLevelTest, RejectsBadFiles) {
+    std::ofstream bad("test_level.lvlb", std::ios::binary);
+    bad << "NOPE this is not a level";
+    bad.close();
+
+    Level level;
+    EXPECT_FALSE(level.loadFromFile("test_level.lvlb"));
+
+    // Valid header but truncated data
+    Level source;
+    source.loadFromFile("test_level.json");
+    source.saveBinary("test_level.lvlb");
+    std::ifstream in("test_level.lvlb", std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream truncated("test_level.lvlb", std::ios::binary);
+    truncated.write(bytes.data(), 60);
+    truncated.close();
+    EXPECT_FALSE(level.loadFromFile("test_level.lvlb"));
+}
+
+TEST_F(CompiledLevelTest, RejectsCorruptIndexes) {
+    Level source;
+    source.loadFromFile("test_level.json");
+    source.saveBinary("test_level.lvlb");
+    std::ifstream in("test_level.lvlb", std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+
+    // The file ends with the obstacle then treasure x-indexes, two
+    // {float x, uint32 index} entries each
+    auto loadPatched = [&](size_t fromEnd, uint32_t value) {
+        std::string patched = bytes;
+        std::memcpy(&patched[patched.size() - fromEnd], &value, sizeof(value));
+        std::ofstream out("test_level.lvlb", std::ios::binary);
+        out.write(patched.data(), patched.size());
+        out.close();
+        Level level;
+        return level.loadFromFile("test_level.lvlb");
+    };
+    EXPECT_TRUE(loadPatched(4, 1));         // Unchanged
+    EXPECT_FALSE(loadPatched(4, 99));       // Treasure index out of range
+    EXPECT_FALSE(loadPatched(4, 0));        // Treasure 0 twice, treasure 1 never
+    EXPECT_FALSE(loadPatched(20, 1000));    // Obstacle index out of range
+
+    float farRight = 5000.0f;
+    uint32_t farRightBits;
+    std::memcpy(&farRightBits, &farRight, sizeof(farRightBits));
+    EXPECT_FALSE(loadPatched(16, farRightBits));  // Treasure index out of x order
+}
+
+TEST_F(CompiledLevelTest, BadManifestKeepsCompiledLevel) {
+    Level source;
+    source.loadFromFile("test_level.json");
+    source.saveBinary("test_level.lvlb");
+    Level level;
+    ASSERT_TRUE(level.loadFromFile("test_level.lvlb"));
+
+    {
+        std::ofstream manifest("test_bad_manifest.json");
+        manifest << R"({"name": "Bad", "length": 4000, "chunkWidth": 0, "chunkCount": 2, "chunkPrefix": "bad_chunk"})";
+    }
+    EXPECT_FALSE(level.loadFromFile("test_bad_manifest.json"));
+    std::remove("test_bad_manifest.json");
+
+    // Still the compiled level, with its queries backed by a live mapping
+    EXPECT_EQ(level.getName(), "Test Level");
+    EXPECT_FALSE(level.isStreaming());
+    ASSERT_EQ(level.getGround().size(), 3);
+    for (float x = -50.0f; x < 2100.0f; x += 5.0f) {
+        EXPECT_EQ(level.hasGroundAt(x), source.hasGroundAt(x)) << "x=" << x;
+    }
+    std::vector<uint32_t> hits;
+    level.findObstaclesOverlapping(470.0f, 0.0f, 520.0f, 1000.0f, hits);
+    EXPECT_EQ(hits.size(), 1u);
+}
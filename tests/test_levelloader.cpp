@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "LevelLoader.h"
+#include "LevelIntroScene.h"
+#include "PlayingScene.h"
+#include "Input.h"
+#include "Score.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+class LevelLoaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::ofstream file("test_loader_level.json");
+        file << R"({
+            "name": "Loader Level",
+            "length": 1500,
+            "groundY": 480,
+            "ground": [{"start": 0, "end": 1500}],
+            "platforms": [{"x": 300, "y": 400, "width": 100, "height": 20}],
+            "treasures": [{"x": 350, "y": 370, "points": 100}],
+            "obstacles": []
+        })";
+        file.close();
+
+        std::ofstream score("test_loader_highscore.dat", std::ios::binary);
+        int highScore = 4321;
+        score.write(reinterpret_cast<const char*>(&highScore), sizeof(highScore));
+    }
+
+    void TearDown() override {
+        std::remove("test_loader_level.json");
+        std::remove("test_loader_highscore.dat");
+
+        SceneManager& sm = SceneManager::instance();
+        while (!sm.isEmpty()) {
+            sm.pop();
+            sm.update(0.0f);
+        }
+        Input::instance().beginFrame();
+    }
+};
+
+TEST_F(LevelLoaderTest, NotStartedHasNoResult) {
+    LevelLoader loader;
+    EXPECT_FALSE(loader.isStarted());
+    EXPECT_FALSE(loader.isReady());
+    EXPECT_EQ(loader.take(), nullptr);
+}
+
+TEST_F(LevelLoaderTest, LoadsLevelAndHighScore) {
+    LevelLoader loader;
+    loader.start("test_loader_level.json", "test_loader_highscore.dat");
+    EXPECT_TRUE(loader.isStarted());
+
+    auto result = loader.take();
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->loaded);
+    EXPECT_EQ(result->level.getName(), "Loader Level");
+    EXPECT_FLOAT_EQ(result->level.getGroundY(), 480.0f);
+    EXPECT_EQ(result->level.getTreasures().size(), 1u);
+    EXPECT_EQ(result->highScore, 4321);
+}
+
+TEST_F(LevelLoaderTest, LoadsOnWorkersAfterPendingSave) {
+    JobSystem jobs(2);
+    JobHandle save = jobs.run([] {
+        SDL_Delay(20);
+        Score::writeHighScore("test_loader_highscore.dat", 5000);
+    });
+
+    LevelLoader loader;
+    loader.start("test_loader_level.json", "test_loader_highscore.dat", jobs, save);
+    auto result = loader.take();
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->loaded);
+    EXPECT_EQ(result->highScore, 5000);  // Read after the save, not before
+}
+
+TEST_F(LevelLoaderTest, PrefersCompiledLevelUnlessStale) {
+    EXPECT_EQ(LevelLoader::resolveLevelPath("test_loader_level.json"), "test_loader_level.json");
+
+    Level source;
+    ASSERT_TRUE(source.loadFromFile("test_loader_level.json"));
+    ASSERT_TRUE(source.saveBinary("test_loader_level.lvlb"));
+    EXPECT_EQ(LevelLoader::resolveLevelPath("test_loader_level.json"), "test_loader_level.lvlb");
+
+    // Level edited after it was compiled
+    namespace fs = std::filesystem;
+    fs::last_write_time("test_loader_level.lvlb",
+                        fs::last_write_time("test_loader_level.json") - std::chrono::seconds(10));
+    EXPECT_EQ(LevelLoader::resolveLevelPath("test_loader_level.json"), "test_loader_level.json");
+    std::remove("test_loader_level.lvlb");
+}
+
+TEST_F(LevelLoaderTest, ReadyAfterLoadCompletes) {
+    LevelLoader loader;
+    loader.start("test_loader_level.json", "test_loader_highscore.dat");
+    while (!loader.isReady()) {
+        SDL_Delay(1);
+    }
+    EXPECT_FLOAT_EQ(loader.getProgress(), 1.0f);
+
+    auto result = loader.take();
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(result->loaded);
+
+    // Result is handed over only once
+    EXPECT_FALSE(loader.isReady());
+    EXPECT_EQ(loader.take(), nullptr);
+}
+
+TEST_F(LevelLoaderTest, MissingFileStillCompletes) {
+    LevelLoader loader;
+    loader.start("does_not_exist.json", "does_not_exist.dat");
+
+    auto result = loader.take();
+    ASSERT_NE(result, nullptr);
+    EXPECT_FALSE(result->loaded);
+    EXPECT_EQ(result->highScore, 0);
+}
+
+TEST_F(LevelLoaderTest, DestroyWhileLoadingJoins) {
+    {
+        LevelLoader loader;
+        loader.start("test_loader_level.json", "test_loader_highscore.dat");
+    }
+    SUCCEED();
+}
+
+TEST_F(LevelLoaderTest, PlayingSceneUsesPreloadedLevel) {
+    LevelLoader loader;
+    loader.start("test_loader_level.json", "test_loader_highscore.dat");
+
+    SceneManager& sm = SceneManager::instance();
+    sm.push(std::make_unique<PlayingScene>(1, loader.take()));
+    sm.update(0.0f);
+    ASSERT_NE(dynamic_cast<PlayingScene*>(sm.current()), nullptr);
+    sm.update(0.016f);
+    EXPECT_NE(dynamic_cast<PlayingScene*>(sm.current()), nullptr);
+}
+
+TEST_F(LevelLoaderTest, IntroWaitsForLoadBeforeStarting) {
+    SceneManager& sm = SceneManager::instance();
+    sm.push(std::make_unique<LevelIntroScene>(1));
+    sm.update(0.0f);
+    auto* intro = dynamic_cast<LevelIntroScene*>(sm.current());
+    ASSERT_NE(intro, nullptr);
+
+    SDL_Event event = {};
+    event.type = SDL_EVENT_KEY_DOWN;
+    event.key.scancode = SDL_SCANCODE_SPACE;
+    Input::instance().processEvent(event);
+    sm.update(0.016f);
+    // Either the press waits for the load, or the load already finished
+    // and was handed over to the next scene
+    EXPECT_TRUE(intro->isStartRequested() || intro->getLoadProgress() >= 1.0f);
+    Input::instance().beginFrame();
+
+    // Keep ticking until the background load lets the intro move on; the
+    // press is remembered after its tick
+    for (int i = 0; i < 1000 && dynamic_cast<LevelIntroScene*>(sm.current()); i++) {
+        sm.update(0.016f);
+        Input::instance().beginFrame();
+        SDL_Delay(1);
+    }
+    EXPECT_NE(dynamic_cast<PlayingScene*>(sm.current()), nullptr);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "LevelTileCache.h"
+#include "PlayingScene.h"
+#include "DisplayManager.h"
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// Software renderer drawing into a design-sized surface
+class LevelTileCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        surface = SDL_CreateSurface(static_cast<int>(DisplayManager::DESIGN_WIDTH),
+                                    static_cast<int>(DisplayManager::DESIGN_HEIGHT),
+                                    SDL_PIXELFORMAT_RGBA32);
+        ASSERT_NE(surface, nullptr);
+        renderer = SDL_CreateSoftwareRenderer(surface);
+        ASSERT_NE(renderer, nullptr);
+
+        // Short level so the finish flag is on screen at the start
+        std::ofstream file("test_tile_level.json");
+        file << R"({
+            "name": "Tile Level",
+            "length": 700,
+            "groundY": 500,
+            "ground": [{"start": 0, "end": 300}, {"start": 380, "end": 900}],
+            "platforms": [{"x": 250, "y": 400, "width": 100, "height": 20}],
+            "treasures": [{"x": 300, "y": 370, "points": 100}],
+            "obstacles": [{"x": 450, "y": 460, "width": 30, "height": 40}]
+        })";
+    }
+
+    void TearDown() override {
+        PlayingScene::setTileCacheEnabled(false);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroySurface(surface);
+        std::remove("test_tile_level.json");
+    }
+
+    std::vector<Uint8> renderFrame(PlayingScene& scene) {
+        scene.render(renderer);
+        SDL_FlushRenderer(renderer);
+        const Uint8* pixels = static_cast<const Uint8*>(surface->pixels);
+        return std::vector<Uint8>(pixels, pixels + surface->pitch * surface->h);
+    }
+
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* renderer = nullptr;
+};
+
+TEST_F(LevelTileCacheTest, VisibleTilesRenderedOnce) {
+    LevelTileCache cache;
+    std::vector<float> rendered;
+    auto renderTile = [&](SDL_Renderer*, float tileX) { rendered.push_back(tileX); };
+
+    // First frame: the two tiles under the camera
+    ASSERT_TRUE(cache.render(renderer, 100.0f, 800.0f, 600.0f, 1, renderTile));
+    EXPECT_EQ(rendered, (std::vector<float>{0.0f, 800.0f}));
+
+    // Next frame has nothing to render, so it prefetches the tile ahead
+    rendered.clear();
+    ASSERT_TRUE(cache.render(renderer, 110.0f, 800.0f, 600.0f, 1, renderTile));
+    EXPECT_EQ(rendered, (std::vector<float>{1600.0f}));
+    EXPECT_EQ(cache.getCachedTileCount(), 3);
+
+    // Scrolling onto the next tile reuses the cached pair; only the new
+    // tile ahead is rendered, into the slot of the tile scrolled past
+    rendered.clear();
+    ASSERT_TRUE(cache.render(renderer, 900.0f, 800.0f, 600.0f, 1, renderTile));
+    EXPECT_EQ(rendered, (std::vector<float>{2400.0f}));
+    EXPECT_EQ(cache.getTilesRendered(), 4);
+    EXPECT_EQ(cache.getCachedTileCount(), 3);
+}
+
+TEST_F(LevelTileCacheTest, NewRevisionRerendersTiles) {
+    LevelTileCache cache;
+    int calls = 0;
+    auto renderTile = [&](SDL_Renderer*, float) { calls++; };
+
+    cache.render(renderer, 0.0f, 800.0f, 600.0f, 1, renderTile);
+    cache.render(renderer, 0.0f, 800.0f, 600.0f, 1, renderTile);
+    EXPECT_EQ(calls, 3);
+
+    cache.render(renderer, 0.0f, 800.0f, 600.0f, 2, renderTile);
+    EXPECT_EQ(calls, 5);
+
+    cache.invalidate();
+    EXPECT_EQ(cache.getCachedTileCount(), 0);
+    cache.render(renderer, 0.0f, 800.0f, 600.0f, 2, renderTile);
+    EXPECT_EQ(calls, 7);
+}
+
+TEST_F(LevelTileCacheTest, CachedFrameMatchesLiveFrame) {
+    PlayingScene scene("test_tile_level.json");
+    scene.onEnter();
+
+    PlayingScene::setTileCacheEnabled(false);
+    std::vector<Uint8> live = renderFrame(scene);
+
+    PlayingScene::setTileCacheEnabled(true);
+    std::vector<Uint8> cached = renderFrame(scene);
+    std::vector<Uint8> cachedAgain = renderFrame(scene);
+
+    ASSERT_EQ(live.size(), cached.size());
+    EXPECT_TRUE(live == cached);
+    EXPECT_TRUE(live == cachedAgain);
+    scene.onExit();
+}
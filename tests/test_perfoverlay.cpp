@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include "PerfOverlay.h"
+#include "RenderStats.h"
+#include "Level.h"
+#include "DisplayManager.h"
+#include <cstdio>
+#include <fstream>
+
+class PerfOverlayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        overlay.setEnabled(false);
+        overlay.setRefreshRate(60.0f);
+        overlay.setLevel(nullptr);
+        surface = SDL_CreateSurface((int)DisplayManager::DESIGN_WIDTH, (int)DisplayManager::DESIGN_HEIGHT,
+                                    SDL_PIXELFORMAT_RGBA32);
+        ASSERT_NE(surface, nullptr);
+        renderer = SDL_CreateSoftwareRenderer(surface);
+        ASSERT_NE(renderer, nullptr);
+        RenderStats::instance().reset();
+    }
+
+    void TearDown() override {
+        overlay.setEnabled(false);
+        overlay.setLevel(nullptr);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroySurface(surface);
+        RenderStats::instance().reset();
+    }
+
+    // Frames until the next refresh (0.25s at 60Hz is 15 frames)
+    void runFrames(int frames, float seconds = 1.0f / 60.0f, int drawCalls = 10) {
+        for (int i = 0; i < frames; i++) {
+            overlay.recordFrame(seconds, drawCalls);
+        }
+    }
+
+    static SDL_Event keyDown(SDL_Scancode scancode) {
+        SDL_Event event = {};
+        event.type = SDL_EVENT_KEY_DOWN;
+        event.key.scancode = scancode;
+        return event;
+    }
+
+    PerfOverlay& overlay = PerfOverlay::instance();
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* renderer = nullptr;
+};
+
+TEST_F(PerfOverlayTest, DisabledByDefaultAndF3Toggles) {
+    EXPECT_FALSE(overlay.isEnabled());
+
+    overlay.handleEvent(keyDown(SDL_SCANCODE_F3));
+    EXPECT_TRUE(overlay.isEnabled());
+
+    SDL_Event repeat = keyDown(SDL_SCANCODE_F3);
+    repeat.key.repeat = true;
+    overlay.handleEvent(repeat);
+    EXPECT_TRUE(overlay.isEnabled());
+
+    overlay.handleEvent(keyDown(SDL_SCANCODE_F4));
+    EXPECT_TRUE(overlay.isEnabled());
+
+    overlay.handleEvent(keyDown(SDL_SCANCODE_F3));
+    EXPECT_FALSE(overlay.isEnabled());
+}
+
+TEST_F(PerfOverlayTest, IgnoresFramesWhileDisabled) {
+    runFrames(30);
+    EXPECT_EQ(overlay.getGraphCount(), 0);
+
+    overlay.render(renderer);
+    EXPECT_EQ(RenderStats::instance().getDrawCalls(), 0);
+}
+
+TEST_F(PerfOverlayTest, GraphKeepsTheLatestFrames) {
+    overlay.setEnabled(true);
+    for (int i = 0; i < PerfOverlay::GRAPH_FRAMES + 10; i++) {
+        overlay.recordFrame((float)(i + 1) / 1000.0f, 0);
+    }
+
+    EXPECT_EQ(overlay.getGraphCount(), PerfOverlay::GRAPH_FRAMES);
+    EXPECT_NEAR(overlay.getGraphMs(0), PerfOverlay::GRAPH_FRAMES + 10.0f, 0.01f);
+    EXPECT_NEAR(overlay.getGraphMs(PerfOverlay::GRAPH_FRAMES - 1), 11.0f, 0.01f);
+    EXPECT_EQ(overlay.getGraphMs(PerfOverlay::GRAPH_FRAMES), 0.0f);
+}
+
+TEST_F(PerfOverlayTest, RefreshesAtLowRate) {
+    overlay.setEnabled(true);
+    runFrames(14);
+    EXPECT_EQ(overlay.getRefreshCount(), 0);
+
+    runFrames(1);
+    EXPECT_EQ(overlay.getRefreshCount(), 1);
+    EXPECT_NEAR(overlay.getStats().fps, 60.0f, 0.5f);
+    EXPECT_NEAR(overlay.getStats().avgFrameMs, 16.67f, 0.05f);
+    EXPECT_FLOAT_EQ(overlay.getStats().drawCalls, 10.0f);
+}
+
+TEST_F(PerfOverlayTest, StatsAverageOverTheInterval) {
+    overlay.setEnabled(true);
+    const Uint64 ms = SDL_GetPerformanceFrequency() / 1000;
+    for (int i = 0; i < 15; i++) {
+        overlay.addUpdateTime(ms);
+        overlay.addUpdateTime(ms);  // Two ticks this frame
+        overlay.addRenderTime(ms * 3);
+        overlay.recordFrame(i == 7 ? 0.05f : 1.0f / 60.0f, 4);
+    }
+
+    ASSERT_EQ(overlay.getRefreshCount(), 1);
+    const PerfOverlay::Stats& stats = overlay.getStats();
+    EXPECT_NEAR(stats.updateMs, 2.0f, 0.01f);
+    EXPECT_NEAR(stats.renderMs, 3.0f, 0.01f);
+    EXPECT_NEAR(stats.maxFrameMs, 50.0f, 0.01f);
+    EXPECT_FLOAT_EQ(stats.drawCalls, 4.0f);
+}
+
+TEST_F(PerfOverlayTest, CountsLiveLevelEntities) {
+    {
+        std::ofstream file("test_overlay_level.json");
+        file << R"({
+            "name": "Overlay", "length": 1000, "groundY": 500,
+            "ground": [{"start": 0, "end": 400}, {"start": 500, "end": 1000}],
+            "platforms": [{"x": 300, "y": 400, "width": 100, "height": 20}],
+            "treasures": [{"x": 350, "y": 370, "points": 100}, {"x": 600, "y": 370, "points": 50},
+                          {"x": 700, "y": 370, "points": 50}],
+            "obstacles": [{"x": 450, "y": 460, "width": 30, "height": 40}]
+        })";
+    }
+    Level level;
+    ASSERT_TRUE(level.loadFromFile("test_overlay_level.json"));
+    std::remove("test_overlay_level.json");
+    level.collectTreasure(1);
+
+    overlay.setEnabled(true);
+    overlay.setLevel(&level);
+    runFrames(15);
+
+    const PerfOverlay::Stats& stats = overlay.getStats();
+    ASSERT_TRUE(stats.haveLevel);
+    EXPECT_EQ(stats.ground, 2);
+    EXPECT_EQ(stats.platforms, 1);
+    EXPECT_EQ(stats.treasures, 2);  // Collected ones don't count
+    EXPECT_EQ(stats.obstacles, 1);
+
+    overlay.clearLevel(&level);
+    runFrames(15);
+    EXPECT_FALSE(overlay.getStats().haveLevel);
+}
+
+TEST_F(PerfOverlayTest, ClearLevelOnlyClearsItsOwn) {
+    Level a;
+    Level b;
+    overlay.setLevel(&b);
+    overlay.clearLevel(&a);  // An exiting scene whose level was replaced
+    overlay.setEnabled(true);
+    runFrames(15);
+    EXPECT_TRUE(overlay.getStats().haveLevel);
+}
+
+TEST_F(PerfOverlayTest, CachedBetweenRefreshes) {
+    overlay.setEnabled(true);
+    runFrames(15);
+
+    overlay.render(renderer);
+    EXPECT_EQ(overlay.getRedrawCount(), 1);
+
+    RenderStats::instance().reset();
+    runFrames(5);
+    overlay.render(renderer);
+    EXPECT_EQ(overlay.getRedrawCount(), 1);
+    EXPECT_EQ(RenderStats::instance().getDrawCalls(), 1);  // Just the cached quad
+
+    runFrames(10);
+    overlay.render(renderer);
+    EXPECT_EQ(overlay.getRedrawCount(), 2);
+}
+
+TEST_F(PerfOverlayTest, DrawsPanelAtBottomLeft) {
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderClear(renderer);
+    overlay.setEnabled(true);
+    runFrames(15);
+    overlay.render(renderer);
+    SDL_FlushRenderer(renderer);
+
+    auto pixel = [&](int x, int y) {
+        const Uint8* p = static_cast<const Uint8*>(surface->pixels) + y * surface->pitch + x * 4;
+        return p[0];
+    };
+    // The translucent black panel darkens the white background
+    int panelY = (int)(DisplayManager::DESIGN_HEIGHT - PerfOverlay::PANEL_HEIGHT);
+    EXPECT_LT(pixel(12, panelY), 200);
+    EXPECT_EQ(pixel(12, 10), 255);
+    EXPECT_EQ(pixel((int)DisplayManager::DESIGN_WIDTH - 10, panelY), 255);
+}
+
+TEST_F(PerfOverlayTest, ReadsHeapUsage) {
+#if defined(__GLIBC__) || defined(_WIN32)
+    EXPECT_GT(PerfOverlay::readHeapBytes(), 0u);
+#else
+    GTEST_SKIP() << "No heap statistics on this platform";
+#endif
+}
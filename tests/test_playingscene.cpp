@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include "PlayingScene.h"
+#include "PauseScene.h"
+#include "GameOverScene.h"
 #include "Input.h"
 #include "DisplayManager.h"
+#include <cstdio>
+#include <fstream>
 
 // Helper to simulate a key press event
 SDL_Event makeKeyDownEvent(SDL_Scancode scancode) {
@@ -22,8 +26,8 @@ SDL_Event makeKeyUpEvent(SDL_Scancode scancode) {
 class PlayingSceneTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        // Reset input state
-        Input::instance().beginFrame();
+        // Reset input state, including keys an earlier test left held
+        Input::instance().reset();
         // Clear any pending scene operations
         SceneManager& sm = SceneManager::instance();
         while (!sm.isEmpty()) {
@@ -217,6 +221,69 @@ TEST_F(PlayingSceneTest, BackInputRequestsSceneChange) {
     SUCCEED();
 }
 
+TEST_F(PlayingSceneTest, PausePushesOverlayAndResumes) {
+    {
+        std::ofstream file("test_pause_level.json");
+        file << R"({"name": "Pause", "length": 100000, "groundY": 500,
+                    "ground": [{"start": 0, "end": 100000}]})";
+    }
+    SceneManager& sm = SceneManager::instance();
+    sm.push(std::make_unique<PlayingScene>(std::string("test_pause_level.json")));
+    sm.update(0.0f);
+    std::remove("test_pause_level.json");
+    Scene* playing = sm.current();
+    EXPECT_TRUE(playing->isOpaque());
+
+    Input& input = Input::instance();
+    input.beginFrame();
+    input.processEvent(makeKeyDownEvent(SDL_SCANCODE_P));
+    sm.update(0.016f);
+    input.beginFrame();
+    sm.update(0.016f);  // Processes the push
+
+    ASSERT_NE(dynamic_cast<PauseScene*>(sm.current()), nullptr);
+    EXPECT_FALSE(sm.current()->isOpaque());
+
+    input.processEvent(makeKeyUpEvent(SDL_SCANCODE_P));
+    input.beginFrame();
+    input.processEvent(makeKeyDownEvent(SDL_SCANCODE_P));
+    sm.update(0.016f);
+    input.processEvent(makeKeyUpEvent(SDL_SCANCODE_P));
+    input.beginFrame();
+    sm.update(0.016f);  // Processes the pop
+
+    EXPECT_EQ(sm.current(), playing);
+}
+
+TEST_F(PlayingSceneTest, ReportsProgressThroughLevel) {
+    {
+        std::ofstream file("test_progress_level.json");
+        file << R"({"name": "Progress", "length": 600, "groundY": 500,
+                    "ground": [{"start": 0, "end": 800}],
+                    "treasures": [{"x": 300, "y": 470, "points": 50}]})";
+    }
+    SceneManager& sm = SceneManager::instance();
+    sm.push(std::make_unique<PlayingScene>(std::string("test_progress_level.json")));
+    sm.update(0.0f);
+    std::remove("test_progress_level.json");
+    auto* playing = dynamic_cast<PlayingScene*>(sm.current());
+    ASSERT_NE(playing, nullptr);
+
+    float startX = playing->getPlayerWorldX();
+    EXPECT_TRUE(playing->isPlayerGrounded());
+    EXPECT_EQ(playing->getLivesLeft(), 3);
+    EXPECT_FALSE(playing->isLevelComplete());
+
+    // 200px a second from x=150: past 600 within 3 seconds
+    for (int i = 0; i < 180 && !playing->isLevelComplete(); i++) {
+        sm.update(1.0f / 60.0f);
+    }
+    EXPECT_GT(playing->getPlayerWorldX(), startX);
+    EXPECT_TRUE(playing->isLevelComplete());
+    EXPECT_EQ(playing->getLivesLeft(), 3);
+    EXPECT_TRUE(playing->getLevel().getTreasures()[0].collected);
+}
+
 TEST_F(PlayingSceneTest, PlayerClampedToScreenBounds) {
     PlayingScene scene;
 
@@ -285,3 +352,47 @@ TEST_F(PlayingSceneTest, SpeedIsReasonable) {
 
     SUCCEED();
 }
+
+TEST_F(PlayingSceneTest, PooledSceneReleasesItsLevel) {
+    {
+        std::ofstream file("test_pooled_level.json");
+        file << R"({"name": "Pooled", "length": 3000, "groundY": 500,
+                    "ground": [{"start": 0, "end": 3000}],
+                    "treasures": [{"x": 900, "y": 450, "points": 10}]})";
+    }
+    SceneManager& sm = SceneManager::instance();
+    sm.push(sm.create<PlayingScene>(std::string("test_pooled_level.json")));
+    sm.update(0.0f);
+    std::remove("test_pooled_level.json");
+    auto* playing = dynamic_cast<PlayingScene*>(sm.current());
+    ASSERT_NE(playing, nullptr);
+    EXPECT_EQ(playing->getLevel().getGround().size(), 1u);
+
+    // Exited into the pool, where it stays alive without its level
+    sm.pop();
+    sm.update(0.0f);
+    EXPECT_TRUE(playing->getLevel().getGround().empty());
+    EXPECT_TRUE(playing->getLevel().getTreasures().empty());
+    sm.clearPool();
+}
+
+TEST_F(PlayingSceneTest, MissingChunkEndsTheRun) {
+    {
+        std::ofstream manifest("test_gap_level.json");
+        manifest << R"({"name": "Gap", "length": 6000, "groundY": 500, "chunkWidth": 2000,
+                        "chunkCount": 3, "chunkPrefix": "test_gap_chunk"})";
+        std::ofstream chunk("test_gap_chunk0.json");
+        chunk << R"({"ground": [{"start": 0, "end": 2000}]})";
+    }
+    // Chunk 1, ahead of the view at the start, doesn't exist
+    SceneManager& sm = SceneManager::instance();
+    sm.push(std::make_unique<PlayingScene>(std::string("test_gap_level.json")));
+    sm.update(0.0f);
+    std::remove("test_gap_level.json");
+    std::remove("test_gap_chunk0.json");
+
+    Input::instance().beginFrame();
+    sm.update(1.0f / 60.0f);
+    sm.update(0.0f);
+    EXPECT_NE(dynamic_cast<GameOverScene*>(sm.current()), nullptr);
+}
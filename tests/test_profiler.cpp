@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "Profiler.h"
+#include <cstring>
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override { Profiler::instance().clear(); }
+    void TearDown() override { Profiler::instance().clear(); }
+};
+
+TEST_F(ProfilerTest, ScopesOutsideFrameAreIgnored) {
+    Profiler& profiler = Profiler::instance();
+    EXPECT_FALSE(profiler.isFrameOpen());
+    EXPECT_EQ(profiler.beginScope("Orphan"), -1);
+    profiler.endScope(-1);
+    EXPECT_EQ(profiler.getFrameCount(), 0);
+    EXPECT_EQ(profiler.getSummaryCount(), 0);
+}
+
+TEST_F(ProfilerTest, RecordsNestedScopesInOrder) {
+    Profiler& profiler = Profiler::instance();
+    profiler.beginFrame();
+    int update = profiler.beginScope("Update");
+    int collisions = profiler.beginScope("Collisions");
+    profiler.endScope(collisions);
+    profiler.endScope(update);
+    int render = profiler.beginScope("Render");
+    profiler.endScope(render);
+    profiler.endFrame();
+
+    ASSERT_EQ(profiler.getFrameCount(), 1);
+    const ProfileFrame& frame = profiler.getFrame(0);
+    ASSERT_EQ(frame.scopeCount, 3);
+    EXPECT_STREQ(frame.scopes[0].name, "Update");
+    EXPECT_EQ(frame.scopes[0].depth, 0);
+    EXPECT_STREQ(frame.scopes[1].name, "Collisions");
+    EXPECT_EQ(frame.scopes[1].depth, 1);
+    EXPECT_STREQ(frame.scopes[2].name, "Render");
+    EXPECT_EQ(frame.scopes[2].depth, 0);
+
+    // Children sit inside their parent, everything inside the frame
+    EXPECT_LE(frame.start, frame.scopes[0].start);
+    EXPECT_LE(frame.scopes[0].start, frame.scopes[1].start);
+    EXPECT_LE(frame.scopes[1].end, frame.scopes[0].end);
+    EXPECT_LE(frame.scopes[2].end, frame.end);
+}
+
+TEST_F(ProfilerTest, MacroTimesEnclosingBlock) {
+    Profiler& profiler = Profiler::instance();
+    profiler.beginFrame();
+    {
+        PROFILE_SCOPE("Outer");
+        PROFILE_SCOPE("Inner");
+    }
+    profiler.endFrame();
+
+#if MYGAME_PROFILING
+    const ProfileFrame& frame = profiler.getFrame(0);
+    ASSERT_EQ(frame.scopeCount, 2);
+    EXPECT_EQ(frame.scopes[1].depth, 1);
+    EXPECT_NE(frame.scopes[0].end, 0u);
+#else
+    EXPECT_EQ(profiler.getFrame(0).scopeCount, 0);
+#endif
+}
+
+TEST_F(ProfilerTest, OpenScopesEndWithFrame) {
+    Profiler& profiler = Profiler::instance();
+    profiler.beginFrame();
+    int handle = profiler.beginScope("Present");
+    profiler.beginFrame();  // Next frame starts while the scope is open
+
+    const ProfileFrame& previous = profiler.getFrame(0);
+    ASSERT_EQ(previous.scopeCount, 1);
+    EXPECT_EQ(previous.scopes[0].end, previous.end);
+
+    // Ending it late doesn't touch the new frame
+    profiler.endScope(handle);
+    profiler.endFrame();
+    EXPECT_EQ(profiler.getFrame(0).scopeCount, 0);
+}
+
+TEST_F(ProfilerTest, FullFrameDropsScopes) {
+    Profiler& profiler = Profiler::instance();
+    profiler.beginFrame();
+    for (int i = 0; i < ProfileFrame::MAX_SCOPES + 3; i++) {
+        int handle = profiler.beginScope("Tiny");
+        profiler.endScope(handle);
+    }
+    profiler.endFrame();
+
+    EXPECT_EQ(profiler.getFrame(0).scopeCount, ProfileFrame::MAX_SCOPES);
+    EXPECT_EQ(profiler.getFrame(0).droppedScopes, 3);
+}
+
+TEST_F(ProfilerTest, RingBufferKeepsRecentFrames) {
+    Profiler& profiler = Profiler::instance();
+    for (int i = 0; i < Profiler::FRAME_HISTORY + 10; i++) {
+        profiler.beginFrame();
+        for (int j = 0; j < i % 5; j++) {
+            profiler.endScope(profiler.beginScope("Work"));
+        }
+    }
+    profiler.endFrame();
+
+    EXPECT_EQ(profiler.getFrameCount(), Profiler::FRAME_HISTORY);
+    // Most recent frame was i = FRAME_HISTORY + 9
+    EXPECT_EQ(profiler.getFrame(0).scopeCount, (Profiler::FRAME_HISTORY + 9) % 5);
+    EXPECT_EQ(profiler.getFrame(1).scopeCount, (Profiler::FRAME_HISTORY + 8) % 5);
+    EXPECT_LE(profiler.getFrame(1).end, profiler.getFrame(0).start);
+}
+
+TEST_F(ProfilerTest, SummaryAccumulatesAcrossFrames) {
+    Profiler& profiler = Profiler::instance();
+    for (int i = 0; i < 3; i++) {
+        profiler.beginFrame();
+        int update = profiler.beginScope("Update");
+        profiler.endScope(profiler.beginScope("Collisions"));
+        profiler.endScope(profiler.beginScope("Collisions"));
+        profiler.endScope(update);
+    }
+    profiler.endFrame();
+
+    ASSERT_EQ(profiler.getSummaryCount(), 2);
+    EXPECT_STREQ(profiler.getSummaryName(0), "Update");  // Parents first
+    EXPECT_EQ(profiler.getSummaryDepth(0), 0);
+    EXPECT_EQ(profiler.getSummaryCalls(0), 3u);
+    EXPECT_STREQ(profiler.getSummaryName(1), "Collisions");
+    EXPECT_EQ(profiler.getSummaryDepth(1), 1);
+    EXPECT_EQ(profiler.getSummaryCalls(1), 6u);
+    EXPECT_LE(profiler.getSummaryTicks(1), profiler.getSummaryTicks(0));
+
+    // Names stay, totals go
+    profiler.resetSummary();
+    EXPECT_EQ(profiler.getSummaryCount(), 2);
+    EXPECT_EQ(profiler.getSummaryCalls(0), 0u);
+    EXPECT_EQ(profiler.getSummaryTicks(1), 0u);
+}
+
+TEST_F(ProfilerTest, EventsKeptWithoutFrames) {
+    Profiler& profiler = Profiler::instance();
+    profiler.recordEvent("Score::loadHighScore", 100, 200);
+    ASSERT_EQ(profiler.getEventCount(), 1);
+    ProfileEvent event = profiler.getEvent(0);
+    EXPECT_STREQ(event.name, "Score::loadHighScore");
+    EXPECT_EQ(event.end - event.start, 100u);
+    EXPECT_EQ(event.thread, SDL_GetCurrentThreadID());
+}
+
+TEST_F(ProfilerTest, EventRingCopiesOldestFirst) {
+    Profiler& profiler = Profiler::instance();
+    for (int i = 0; i < Profiler::EVENT_HISTORY + 5; i++) {
+        profiler.recordEvent("Load", i, i + 1);
+    }
+    EXPECT_EQ(profiler.getEventCount(), Profiler::EVENT_HISTORY);
+    EXPECT_EQ(profiler.getEvent(0).start, (Uint64)(Profiler::EVENT_HISTORY + 4));
+
+    std::vector<ProfileEvent> events;
+    profiler.copyEvents(events);
+    ASSERT_EQ(events.size(), (size_t)Profiler::EVENT_HISTORY);
+    EXPECT_EQ(events.front().start, 5u);
+    EXPECT_EQ(events.back().start, (Uint64)(Profiler::EVENT_HISTORY + 4));
+}
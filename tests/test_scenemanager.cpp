@@ -9,7 +9,10 @@ public:
     static std::vector<std::string> events;
     std::string name;
 
-    MockScene(const std::string& sceneName) : name(sceneName) {}
+    bool opaque;
+    float alpha = -1.0f;
+
+    MockScene(const std::string& sceneName, bool isOpaque = false) : name(sceneName), opaque(isOpaque) {}
 
     void onEnter() override { events.push_back(name + ":onEnter"); }
     void onExit() override { events.push_back(name + ":onExit"); }
@@ -17,10 +20,28 @@ public:
     void onResume() override { events.push_back(name + ":onResume"); }
     void update(float deltaTime) override { events.push_back(name + ":update"); }
     void render(SDL_Renderer* renderer) override { events.push_back(name + ":render"); }
+    void setInterpolation(float renderAlpha) override { alpha = renderAlpha; }
+    bool isOpaque() const override { return opaque; }
 };
 
 std::vector<std::string> MockScene::events;
 
+// Scene SceneManager recycles (it has reuse())
+class PooledScene : public Scene {
+public:
+    static int constructed;
+    int value;
+    int warmUps = 0;
+
+    explicit PooledScene(int initial = 0) : value(initial) { constructed++; }
+    void reuse(int initial = 0) { value = initial; }
+
+    void render(SDL_Renderer* renderer) override {}
+    void warmUp(SDL_Renderer* renderer) override { warmUps++; }
+};
+
+int PooledScene::constructed = 0;
+
 class SceneManagerTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -32,6 +53,8 @@ protected:
             sm.update(0.0f);  // Process the pop
         }
         MockScene::events.clear();  // Clear events from cleanup
+        sm.clearPool();
+        PooledScene::constructed = 0;
     }
 
     void TearDown() override {
@@ -41,6 +64,7 @@ protected:
             sm.pop();
             sm.update(0.0f);
         }
+        sm.clearPool();
     }
 };
 
@@ -187,6 +211,56 @@ TEST_F(SceneManagerTest, RenderCallsAllScenes) {
     EXPECT_EQ(MockScene::events[1], "B:render");
 }
 
+TEST_F(SceneManagerTest, OpaqueSceneHidesScenesBelow) {
+    SceneManager& sm = SceneManager::instance();
+
+    sm.push(std::make_unique<MockScene>("A", true));
+    sm.push(std::make_unique<MockScene>("B", true));
+    sm.update(0.0f);
+    MockScene::events.clear();
+
+    sm.render(nullptr);
+
+    ASSERT_EQ(MockScene::events.size(), 1u);
+    EXPECT_EQ(MockScene::events[0], "B:render");
+}
+
+TEST_F(SceneManagerTest, OverlaysDrawOverTopmostOpaqueScene) {
+    SceneManager& sm = SceneManager::instance();
+
+    sm.push(std::make_unique<MockScene>("A", true));
+    sm.push(std::make_unique<MockScene>("B", true));
+    sm.push(std::make_unique<MockScene>("C"));
+    sm.push(std::make_unique<MockScene>("D"));
+    sm.update(0.0f);
+    MockScene::events.clear();
+
+    sm.render(nullptr);
+
+    ASSERT_EQ(MockScene::events.size(), 3u);
+    EXPECT_EQ(MockScene::events[0], "B:render");
+    EXPECT_EQ(MockScene::events[1], "C:render");
+    EXPECT_EQ(MockScene::events[2], "D:render");
+}
+
+TEST_F(SceneManagerTest, OnlyTopSceneIsInterpolated) {
+    SceneManager& sm = SceneManager::instance();
+
+    auto below = std::make_unique<MockScene>("A", true);
+    auto top = std::make_unique<MockScene>("B");
+    MockScene* belowScene = below.get();
+    MockScene* topScene = top.get();
+    sm.push(std::move(below));
+    sm.push(std::move(top));
+    sm.update(0.0f);
+
+    sm.render(nullptr, 0.25f);
+
+    // The scene below isn't updating, so it stays at its last tick
+    EXPECT_FLOAT_EQ(belowScene->alpha, 1.0f);
+    EXPECT_FLOAT_EQ(topScene->alpha, 0.25f);
+}
+
 TEST_F(SceneManagerTest, PendingOperationsProcessedInOrder) {
     SceneManager& sm = SceneManager::instance();
 
@@ -201,3 +275,79 @@ TEST_F(SceneManagerTest, PendingOperationsProcessedInOrder) {
     EXPECT_EQ(MockScene::events[1], "A:onPause");
     EXPECT_EQ(MockScene::events[2], "B:onEnter");
 }
+
+TEST_F(SceneManagerTest, ExitedSceneIsReusedByNextCreate) {
+    SceneManager& sm = SceneManager::instance();
+
+    sm.push(sm.create<PooledScene>(1));
+    sm.update(0.0f);
+    Scene* first = sm.current();
+    sm.pop();
+    sm.update(0.0f);
+    EXPECT_EQ(sm.getPooledCount(), 1);
+
+    sm.push(sm.create<PooledScene>(7));
+    sm.update(0.0f);
+    EXPECT_EQ(sm.current(), first);
+    EXPECT_EQ(static_cast<PooledScene*>(sm.current())->value, 7);
+    EXPECT_EQ(PooledScene::constructed, 1);
+    EXPECT_EQ(sm.getPooledCount(), 0);
+}
+
+TEST_F(SceneManagerTest, ScenesWithoutReuseAreNotPooled) {
+    SceneManager& sm = SceneManager::instance();
+
+    sm.push(sm.create<MockScene>("A"));
+    sm.update(0.0f);
+    sm.pop();
+    sm.update(0.0f);
+    EXPECT_EQ(sm.getPooledCount(), 0);
+
+    sm.prepare<MockScene>("B");
+    EXPECT_EQ(sm.getPooledCount(), 0);
+}
+
+TEST_F(SceneManagerTest, PrepareConstructsAheadOfTheTransition) {
+    SceneManager& sm = SceneManager::instance();
+
+    sm.prepare<PooledScene>();
+    sm.prepare<PooledScene>();  // One is already waiting
+    EXPECT_EQ(PooledScene::constructed, 1);
+    EXPECT_EQ(sm.getPooledCount(), 1);
+
+    sm.replace(sm.create<PooledScene>(3));
+    sm.update(0.0f);
+    EXPECT_EQ(PooledScene::constructed, 1);
+    EXPECT_EQ(static_cast<PooledScene*>(sm.current())->value, 3);
+}
+
+TEST_F(SceneManagerTest, KeepsOneSparePerType) {
+    SceneManager& sm = SceneManager::instance();
+
+    sm.push(sm.create<PooledScene>());
+    sm.push(sm.create<PooledScene>());
+    sm.update(0.0f);
+    sm.pop();
+    sm.pop();
+    sm.update(0.0f);
+    EXPECT_EQ(PooledScene::constructed, 2);
+    EXPECT_EQ(sm.getPooledCount(), 1);
+}
+
+TEST_F(SceneManagerTest, WarmsUpPreparedScenesOnRender) {
+    SceneManager& sm = SceneManager::instance();
+    SDL_Surface* surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32);
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+    ASSERT_NE(renderer, nullptr);
+
+    sm.prepare<PooledScene>();
+    sm.render(renderer);
+    sm.render(renderer);
+
+    sm.push(sm.create<PooledScene>());
+    sm.update(0.0f);
+    EXPECT_EQ(static_cast<PooledScene*>(sm.current())->warmUps, 1);
+
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+}
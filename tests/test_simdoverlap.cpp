@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "SimdOverlap.h"
+#include <random>
+#include <vector>
+
+static const SimdPath allPaths[] = {SimdPath::Scalar, SimdPath::SSE2, SimdPath::AVX2, SimdPath::NEON};
+
+class SimdOverlapTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Coarse grid values so many comparisons land exactly on an edge
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> coord(0, 40);
+        std::uniform_int_distribution<int> size(0, 6);
+        for (int i = 0; i < 203; i++) {
+            x.push_back(coord(rng) * 5.0f);
+            y.push_back(coord(rng) * 5.0f);
+            w.push_back(size(rng) * 5.0f);
+            h.push_back(size(rng) * 5.0f);
+        }
+        skip.assign((x.size() + 63) / 64, 0);
+        for (size_t i = 0; i < x.size(); i += 3) {
+            skip[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    }
+
+    std::vector<uint32_t> rects(size_t first, size_t last, float minX, float minY,
+                                float maxX, float maxY, SimdPath path) {
+        std::vector<uint32_t> out(last - first);
+        out.resize(findRectsOverlapping(x.data(), y.data(), w.data(), h.data(),
+                                        first, last, minX, minY, maxX, maxY, out.data(), path));
+        return out;
+    }
+
+    std::vector<uint32_t> circle(size_t first, size_t last, const uint64_t* skipBits,
+                                 float cx, float cy, float radiusSq, SimdPath path) {
+        std::vector<uint32_t> out(last - first);
+        out.resize(findPointsInCircle(x.data(), y.data(), skipBits,
+                                      first, last, cx, cy, radiusSq, out.data(), path));
+        return out;
+    }
+
+    std::vector<uint32_t> span(size_t first, size_t last, const uint64_t* skipBits,
+                               float minX, float maxX, SimdPath path) {
+        std::vector<uint32_t> out(last - first);
+        out.resize(findPointsInSpan(x.data(), skipBits, first, last, minX, maxX, out.data(), path));
+        return out;
+    }
+
+    std::vector<float> x, y, w, h;
+    std::vector<uint64_t> skip;
+};
+
+TEST_F(SimdOverlapTest, DetectedPathIsSupported) {
+    EXPECT_TRUE(isSimdPathSupported(getSimdPath()));
+    EXPECT_TRUE(isSimdPathSupported(SimdPath::Scalar));
+}
+
+TEST_F(SimdOverlapTest, ScalarRectsMatchDefinition) {
+    auto hits = rects(0, x.size(), 50.0f, 50.0f, 100.0f, 80.0f, SimdPath::Scalar);
+    std::vector<uint32_t> expected;
+    for (size_t i = 0; i < x.size(); i++) {
+        if (50.0f < x[i] + w[i] && 100.0f > x[i] && 50.0f < y[i] + h[i] && 80.0f > y[i]) {
+            expected.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    EXPECT_EQ(hits, expected);
+}
+
+TEST_F(SimdOverlapTest, TouchingEdgesDoNotOverlap) {
+    x = {10.0f}; y = {10.0f}; w = {10.0f}; h = {10.0f};
+    for (SimdPath path : allPaths) {
+        EXPECT_TRUE(rects(0, 1, 20.0f, 10.0f, 30.0f, 20.0f, path).empty());
+        EXPECT_TRUE(rects(0, 1, 0.0f, 10.0f, 10.0f, 20.0f, path).empty());
+        EXPECT_EQ(rects(0, 1, 19.0f, 10.0f, 30.0f, 20.0f, path).size(), 1u);
+    }
+}
+
+TEST_F(SimdOverlapTest, AllPathsMatchScalarForRects) {
+    // Every start/length mix exercises full vectors plus scalar tails
+    for (SimdPath path : allPaths) {
+        for (size_t first = 0; first < 9; first++) {
+            for (size_t last = first; last < first + 19; last++) {
+                EXPECT_EQ(rects(first, last, 40.0f, 30.0f, 120.0f, 150.0f, path),
+                          rects(first, last, 40.0f, 30.0f, 120.0f, 150.0f, SimdPath::Scalar))
+                    << getSimdPathName(path) << " [" << first << ", " << last << ")";
+            }
+        }
+        EXPECT_EQ(rects(0, x.size(), 0.0f, 0.0f, 200.0f, 200.0f, path),
+                  rects(0, x.size(), 0.0f, 0.0f, 200.0f, 200.0f, SimdPath::Scalar));
+    }
+}
+
+TEST_F(SimdOverlapTest, AllPathsMatchScalarForCircles) {
+    for (SimdPath path : allPaths) {
+        for (float radius : {0.0f, 5.0f, 25.0f, 60.0f}) {
+            EXPECT_EQ(circle(0, x.size(), nullptr, 100.0f, 100.0f, radius * radius, path),
+                      circle(0, x.size(), nullptr, 100.0f, 100.0f, radius * radius, SimdPath::Scalar))
+                << getSimdPathName(path);
+            EXPECT_EQ(circle(5, x.size() - 3, skip.data(), 100.0f, 100.0f, radius * radius, path),
+                      circle(5, x.size() - 3, skip.data(), 100.0f, 100.0f, radius * radius, SimdPath::Scalar))
+                << getSimdPathName(path);
+        }
+    }
+}
+
+TEST_F(SimdOverlapTest, AllPathsMatchScalarForSpans) {
+    for (SimdPath path : allPaths) {
+        EXPECT_EQ(span(0, x.size(), nullptr, 50.0f, 150.0f, path),
+                  span(0, x.size(), nullptr, 50.0f, 150.0f, SimdPath::Scalar));
+        EXPECT_EQ(span(61, 131, skip.data(), 50.0f, 150.0f, path),
+                  span(61, 131, skip.data(), 50.0f, 150.0f, SimdPath::Scalar));
+    }
+}
+
+TEST_F(SimdOverlapTest, SkippedPointsAreLeftOut) {
+    // Bits straddling a 64-bit word boundary
+    x.assign(80, 10.0f);
+    y.assign(80, 10.0f);
+    std::vector<uint64_t> bits(2, 0);
+    bits[0] |= uint64_t(1) << 63;
+    bits[1] |= uint64_t(1) << 0;
+    for (SimdPath path : allPaths) {
+        auto hits = circle(60, 68, bits.data(), 10.0f, 10.0f, 1.0f, path);
+        EXPECT_EQ(hits, (std::vector<uint32_t>{60, 61, 62, 65, 66, 67})) << getSimdPathName(path);
+        EXPECT_EQ(span(60, 68, bits.data(), 0.0f, 20.0f, path), hits) << getSimdPathName(path);
+    }
+}
+
+TEST_F(SimdOverlapTest, EmptyRangeFindsNothing) {
+    for (SimdPath path : allPaths) {
+        EXPECT_TRUE(rects(4, 4, -1000.0f, -1000.0f, 1000.0f, 1000.0f, path).empty());
+        EXPECT_TRUE(circle(4, 4, nullptr, 0.0f, 0.0f, 1e9f, path).empty());
+        EXPECT_TRUE(span(4, 4, nullptr, -1000.0f, 1000.0f, path).empty());
+    }
+}
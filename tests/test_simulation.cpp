@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "Simulation.h"
+#include "PlayingScene.h"
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Gaps to fall into and treasures to collect, so runs that diverge show
+const char* const LEVEL_PATH = "test_simulation_level.json";
+
+void writeLevel() {
+    std::ofstream file(LEVEL_PATH);
+    file << R"({"name": "Simulation", "length": 3000, "groundY": 500,
+                "ground": [{"start": 0, "end": 600}, {"start": 700, "end": 1400},
+                           {"start": 1500, "end": 3100}],
+                "platforms": [{"x": 400, "y": 420, "width": 120, "height": 20}],
+                "treasures": [{"x": 460, "y": 390, "points": 50},
+                              {"x": 1000, "y": 470, "points": 100}]})";
+}
+
+SDL_Event makeJumpEvent(bool down) {
+    SDL_Event event = {};
+    event.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+    event.key.scancode = SDL_SCANCODE_SPACE;
+    return event;
+}
+
+// Plays the level with a jump every jumpEvery ticks, restarting whenever
+// the run ends, and returns a checksum of the state after every tick
+Uint32 runScripted(int ticks, int jumpEvery) {
+    Simulation simulation;
+    SceneManager& scenes = simulation.getScenes();
+    Input& input = simulation.getInput();
+    Uint32 checksum = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        if (!dynamic_cast<PlayingScene*>(scenes.current())) {
+            if (scenes.isEmpty()) {
+                scenes.push(scenes.create<PlayingScene>(std::string(LEVEL_PATH)));
+            } else {
+                scenes.replace(scenes.create<PlayingScene>(std::string(LEVEL_PATH)));
+            }
+            scenes.update(0.0f);
+            input.beginFrame();
+        }
+        if (tick % jumpEvery == 0) {
+            input.processEvent(makeJumpEvent(true));
+        } else if (tick % jumpEvery == 1) {
+            input.processEvent(makeJumpEvent(false));
+        }
+        scenes.update(1.0f / 60.0f);
+        input.beginFrame();
+        if (auto* playing = dynamic_cast<PlayingScene*>(scenes.current())) {
+            checksum = checksum * 31u + playing->getStateChecksum();
+        }
+    }
+    return checksum;
+}
+
+struct ThreadRun {
+    int jumpEvery;
+    Uint32 checksum;
+};
+
+int SDLCALL runThread(void* data) {
+    ThreadRun* run = static_cast<ThreadRun*>(data);
+    run->checksum = runScripted(2000, run->jumpEvery);
+    return 0;
+}
+
+class EmptyScene : public Scene {
+public:
+    void update(float) override {}
+    void render(SDL_Renderer*) override {}
+};
+
+// Replaces itself with an EmptyScene on its first update
+class ReplacingScene : public EmptyScene {
+public:
+    void update(float) override { requestReplace<EmptyScene>(); }
+};
+
+}  // namespace
+
+class SimulationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        writeLevel();
+        Input::instance().reset();  // Whatever earlier tests left held
+    }
+    void TearDown() override { std::remove(LEVEL_PATH); }
+};
+
+TEST_F(SimulationTest, OwnsItsSceneStackAndInput) {
+    Simulation a;
+    Simulation b;
+    a.getScenes().push(a.getScenes().create<PlayingScene>(std::string(LEVEL_PATH)));
+    a.getScenes().update(0.0f);
+
+    Scene* scene = a.getScenes().current();
+    ASSERT_NE(scene, nullptr);
+    EXPECT_EQ(&scene->getContext(), &a.getContext());
+    EXPECT_EQ(&scene->getScenes(), &a.getScenes());
+    EXPECT_EQ(&scene->getInput(), &a.getInput());
+    EXPECT_TRUE(b.getScenes().isEmpty());
+    EXPECT_TRUE(SceneManager::instance().isEmpty());
+
+    // No overlay and no high-score file
+    EXPECT_EQ(a.getContext().overlay, nullptr);
+    EXPECT_TRUE(a.getContext().highScoreFile.empty());
+}
+
+TEST_F(SimulationTest, GlobalContextIsTheSingletons) {
+    GameContext& global = GameContext::global();
+    EXPECT_EQ(global.scenes, &SceneManager::instance());
+    EXPECT_EQ(global.input, &Input::instance());
+    EXPECT_EQ(&SceneManager::instance().getContext(), &global);
+}
+
+TEST_F(SimulationTest, SceneRequestsGoToTheirOwnManager) {
+    Simulation simulation;
+    SceneManager& scenes = simulation.getScenes();
+    scenes.push(std::make_unique<ReplacingScene>());
+    scenes.update(0.016f);  // Enters and requests the replace
+    scenes.update(0.016f);  // Processes it
+
+    ASSERT_NE(scenes.current(), nullptr);
+    EXPECT_EQ(dynamic_cast<ReplacingScene*>(scenes.current()), nullptr);
+    EXPECT_TRUE(SceneManager::instance().isEmpty());
+
+    scenes.pop();
+    scenes.update(0.0f);
+    EXPECT_TRUE(scenes.isEmpty());  // Replaced, not pushed
+}
+
+TEST_F(SimulationTest, InputIgnoresOtherInstances) {
+    Simulation a;
+    Simulation b;
+    a.getInput().processEvent(makeJumpEvent(true));
+    EXPECT_TRUE(a.getInput().isHeld(Action::Jump));
+    EXPECT_FALSE(b.getInput().isHeld(Action::Jump));
+    EXPECT_FALSE(Input::instance().isHeld(Action::Jump));
+}
+
+TEST_F(SimulationTest, RunsRepeatExactly) {
+    EXPECT_EQ(runScripted(2000, 45), runScripted(2000, 45));
+    EXPECT_NE(runScripted(2000, 45), runScripted(2000, 30));
+}
+
+TEST_F(SimulationTest, ParallelRunsMatchSerialRuns) {
+    const int jumpIntervals[] = {45, 30, 45, 60};
+    std::vector<ThreadRun> runs;
+    for (int jumpEvery : jumpIntervals) {
+        runs.push_back({jumpEvery, 0});
+    }
+
+    std::vector<SDL_Thread*> threads;
+    for (ThreadRun& run : runs) {
+        threads.push_back(SDL_CreateThread(runThread, "SimulationTest", &run));
+        ASSERT_NE(threads.back(), nullptr);
+    }
+    for (SDL_Thread* thread : threads) {
+        SDL_WaitThread(thread, nullptr);
+    }
+
+    for (const ThreadRun& run : runs) {
+        EXPECT_EQ(run.checksum, runScripted(2000, run.jumpEvery)) << "jump every " << run.jumpEvery;
+    }
+    EXPECT_TRUE(SceneManager::instance().isEmpty());
+}
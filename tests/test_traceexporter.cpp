@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "TraceExporter.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <fstream>
+
+using json = nlohmann::json;
+
+class TraceExporterTest : public ::testing::Test {
+protected:
+    void SetUp() override { Profiler::instance().clear(); }
+
+    void TearDown() override {
+        Profiler::instance().clear();
+        std::remove("test_trace.json");
+    }
+
+    // Two frames with nested scopes, plus an event from a worker thread
+    static void recordFrames() {
+        Profiler& profiler = Profiler::instance();
+        for (int i = 0; i < 2; i++) {
+            profiler.beginFrame();
+            int update = profiler.beginScope("SceneManager::update");
+            profiler.endScope(profiler.beginScope("PlayingScene::update"));
+            profiler.endScope(update);
+        }
+        profiler.endFrame();
+
+        SDL_Thread* worker = SDL_CreateThread([](void*) -> int {
+            Uint64 start = SDL_GetPerformanceCounter();
+            Profiler::instance().recordEvent("LevelLoader::run", start, start + 10);
+            return 0;
+        }, "TraceTestWorker", nullptr);
+        ASSERT_NE(worker, nullptr);
+        SDL_WaitThread(worker, nullptr);
+    }
+
+    static std::vector<json> named(const json& trace, const std::string& name) {
+        std::vector<json> found;
+        for (const json& event : trace["traceEvents"]) {
+            if (event["name"] == name) {
+                found.push_back(event);
+            }
+        }
+        return found;
+    }
+};
+
+TEST_F(TraceExporterTest, ProducesTraceEventJson) {
+    recordFrames();
+    ProfileCapture capture = ProfileCapture::take(Profiler::instance());
+    ASSERT_EQ(capture.frames.size(), 2u);
+    ASSERT_EQ(capture.events.size(), 1u);
+
+    json trace = json::parse(TraceExporter::toJson(capture));
+    ASSERT_TRUE(trace.contains("traceEvents"));
+    EXPECT_EQ(trace["displayTimeUnit"], "ms");
+
+    std::vector<json> frames = named(trace, "Frame");
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0]["ph"], "X");
+    EXPECT_GE(frames[0]["ts"].get<double>(), 0.0);
+    EXPECT_GE(frames[0]["dur"].get<double>(), 0.0);
+    EXPECT_EQ(frames[0]["args"]["scopes"], 2);
+
+    // Scopes share the main thread's track
+    std::vector<json> scopes = named(trace, "PlayingScene::update");
+    ASSERT_EQ(scopes.size(), 2u);
+    EXPECT_EQ(scopes[0]["tid"], frames[0]["tid"]);
+    EXPECT_GE(scopes[0]["ts"].get<double>(), frames[0]["ts"].get<double>());
+
+    // The worker's event gets its own named track
+    std::vector<json> loads = named(trace, "LevelLoader::run");
+    ASSERT_EQ(loads.size(), 1u);
+    EXPECT_NE(loads[0]["tid"], frames[0]["tid"]);
+    bool workerNamed = false;
+    for (const json& meta : named(trace, "thread_name")) {
+        if (meta["tid"] == loads[0]["tid"]) {
+            workerNamed = meta["args"]["name"] == "Worker";
+        }
+    }
+    EXPECT_TRUE(workerNamed);
+}
+
+TEST_F(TraceExporterTest, CaptureWritesFileInBackground) {
+    recordFrames();
+    TraceExporter exporter;
+    ASSERT_TRUE(exporter.capture(Profiler::instance(), "test_trace.json"));
+    EXPECT_TRUE(exporter.wait());
+    EXPECT_FALSE(exporter.isWriting());
+
+    std::ifstream file("test_trace.json");
+    ASSERT_TRUE(file.is_open());
+    json trace = json::parse(file);
+    EXPECT_EQ(named(trace, "Frame").size(), 2u);
+
+    // Recording carries on while (and after) the file is written
+    Profiler::instance().beginFrame();
+    Profiler::instance().endFrame();
+    ASSERT_TRUE(exporter.capture(Profiler::instance(), "test_trace.json"));
+    EXPECT_TRUE(exporter.wait());
+}
+
+TEST_F(TraceExporterTest, ReportsWriteFailure) {
+    TraceExporter exporter;
+    ASSERT_TRUE(exporter.capture(Profiler::instance(), "no_such_dir/trace.json"));
+    EXPECT_FALSE(exporter.wait());
+}
@@ -0,0 +1,98 @@
+#pragma once
+// Splits a whole-level JSON document into a streaming manifest plus one JSON
+// file per chunkWidth-wide X range (see Level::streamTo).
+//
+// Ground segments are cut at chunk boundaries. Platforms, obstacles and
+// treasures go to the chunk containing their left edge, so anything wider
+// than a chunk would be dropped from view early; those are reported.
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+inline bool writeChunkedLevel(const nlohmann::json& level, const std::string& manifestPath, float chunkWidth) {
+    namespace fs = std::filesystem;
+    using nlohmann::json;
+
+    float length = level.value("length", 2000.0f);
+    int chunkCount = std::max(1, static_cast<int>(std::ceil(length / chunkWidth)) + 1);
+
+    auto chunkOf = [&](float x) {
+        int index = static_cast<int>(std::floor(x / chunkWidth));
+        return std::clamp(index, 0, chunkCount - 1);
+    };
+
+    std::vector<json> chunks(chunkCount);
+    for (auto& chunk : chunks) {
+        chunk = {{"ground", json::array()}, {"platforms", json::array()},
+                 {"treasures", json::array()}, {"obstacles", json::array()}};
+    }
+
+    if (level.contains("ground")) {
+        for (const auto& seg : level["ground"]) {
+            float start = seg.value("start", 0.0f);
+            float end = seg.value("end", 0.0f);
+            if (end < start) continue;
+            for (int i = chunkOf(start); i <= chunkOf(end); i++) {
+                float chunkStart = i * chunkWidth;
+                float chunkEnd = chunkStart + chunkWidth;
+                float s = (i == chunkOf(start)) ? start : chunkStart;
+                float e = (i == chunkOf(end)) ? end : chunkEnd;
+                chunks[i]["ground"].push_back({{"start", s}, {"end", e}});
+            }
+        }
+    }
+
+    int tooWide = 0;
+    for (const char* key : {"platforms", "obstacles"}) {
+        if (!level.contains(key)) continue;
+        for (const auto& e : level[key]) {
+            float x = e.value("x", 0.0f);
+            if (e.value("width", 0.0f) > chunkWidth) tooWide++;
+            chunks[chunkOf(x)][key].push_back(e);
+        }
+    }
+    if (level.contains("treasures")) {
+        for (const auto& t : level["treasures"]) {
+            chunks[chunkOf(t.value("x", 0.0f))]["treasures"].push_back(t);
+        }
+    }
+    if (tooWide > 0) {
+        std::fprintf(stderr, "Warning: %d entities are wider than a chunk (%.0f)\n", tooWide, chunkWidth);
+    }
+
+    // Chunks live in <manifest stem>_chunks/ next to the manifest
+    fs::path manifest(manifestPath);
+    std::string chunkDirName = manifest.stem().string() + "_chunks";
+    fs::path chunkDir = manifest.parent_path() / chunkDirName;
+    std::error_code ec;
+    fs::create_directories(chunkDir, ec);
+    if (ec) {
+        std::fprintf(stderr, "Failed to create %s\n", chunkDir.string().c_str());
+        return false;
+    }
+
+    for (int i = 0; i < chunkCount; i++) {
+        std::ofstream out(chunkDir / ("chunk" + std::to_string(i) + ".json"));
+        if (!out.is_open()) return false;
+        out << chunks[i].dump();
+    }
+
+    json manifestData = {
+        {"name", level.value("name", "Unnamed Level")},
+        {"length", length},
+        {"groundY", level.value("groundY", 500.0f)},
+        {"chunkWidth", chunkWidth},
+        {"chunkCount", chunkCount},
+        {"chunkPrefix", chunkDirName + "/chunk"}
+    };
+    std::ofstream out(manifestPath);
+    if (!out.is_open()) return false;
+    out << manifestData.dump(2);
+    return true;
+}
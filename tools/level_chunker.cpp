@@ -0,0 +1,46 @@
+// Converts a whole-level JSON file into a chunked streaming level.
+//
+//   LevelChunker <input.json> <output.json> [chunkWidth]
+//
+// Writes the manifest to <output.json> and the chunks to
+// <output stem>_chunks/chunk<N>.json next to it.
+
+#include "LevelChunker.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: LevelChunker <input.json> <output.json> [chunkWidth]\n");
+        return 1;
+    }
+
+    float chunkWidth = (argc > 3) ? std::strtof(argv[3], nullptr) : 2000.0f;
+    if (chunkWidth <= 0.0f) {
+        std::fprintf(stderr, "chunkWidth must be positive\n");
+        return 1;
+    }
+
+    std::ifstream file(argv[1]);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    nlohmann::json level;
+    try {
+        level = nlohmann::json::parse(file);
+    }
+    catch (const nlohmann::json::exception& e) {
+        std::fprintf(stderr, "JSON parse error: %s\n", e.what());
+        return 1;
+    }
+
+    if (!writeChunkedLevel(level, argv[2], chunkWidth)) {
+        std::fprintf(stderr, "Failed to write %s\n", argv[2]);
+        return 1;
+    }
+    std::printf("Wrote %s\n", argv[2]);
+    return 0;
+}
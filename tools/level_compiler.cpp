@@ -0,0 +1,42 @@
+// Compiles a level JSON file into the flat binary format that Level maps
+// and uses in place (see Level::saveBinary for the layout).
+//
+//   LevelCompiler <input.json> <output.lvlb>
+
+#include <SDL3/SDL.h>
+#include "Level.h"
+#include <cstdio>
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: LevelCompiler <input.json> <output.lvlb>\n");
+        return 1;
+    }
+
+    Level level;
+    if (!level.loadFromFile(argv[1])) {
+        std::fprintf(stderr, "Failed to load %s\n", argv[1]);
+        return 1;
+    }
+    if (level.isStreaming()) {
+        std::fprintf(stderr, "%s is a chunked manifest; compile the source level instead\n", argv[1]);
+        return 1;
+    }
+
+    if (!level.saveBinary(argv[2])) {
+        std::fprintf(stderr, "Failed to write %s\n", argv[2]);
+        return 1;
+    }
+
+    // Round-trip check
+    Level compiled;
+    if (!compiled.loadFromFile(argv[2]) ||
+        compiled.getGround().size() != level.getGround().size() ||
+        compiled.getTreasures().size() != level.getTreasures().size()) {
+        std::fprintf(stderr, "Verification of %s failed\n", argv[2]);
+        return 1;
+    }
+
+    std::printf("Wrote %s\n", argv[2]);
+    return 0;
+}
@@ -0,0 +1,512 @@
+// Bot playtest farm: plays every level in a directory thousands of times,
+// headless and on every core, and reports how often each level gets
+// finished, where the bots die and which treasures they ever reach.
+//
+//   PlaytestFarm [--levels DIR] [--attempts N] [--policy NAME] [--threads N]
+//                [--seconds S] [--tick-rate HZ] [--seed N] [--json FILE]
+//
+// Run from the repository root (the default DIR is assets/levels).
+// Each attempt is one life from the start of a level, played by one of
+// three jump policies, taken in turn unless --policy picks one:
+//
+//   random    jumps on any tick with a fixed chance
+//   scripted  jumps at a fixed interval, interval and phase varying per attempt
+//   search    replays the level from the start, each time trying one more
+//             jump shortly before the last death, best-first by distance
+//             reached, until it finishes or runs out of replays
+//
+// An attempt runs in its own Simulation, as one job on a JobSystem; idle
+// threads steal queued attempts, so slow search attempts don't leave
+// cores idle.
+
+#include <SDL3/SDL.h>
+#include "Simulation.h"
+#include "PlayingScene.h"
+#include "FixedTimestep.h"
+#include "JobSystem.h"
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+enum Policy { Random, Scripted, Search, POLICY_COUNT };
+const char* const POLICY_NAMES[POLICY_COUNT] = {"random", "scripted", "search"};
+
+constexpr float DEATH_BIN_WIDTH = 100.0f;  // Hotspot resolution, world px
+constexpr int SEARCH_REPLAYS = 200;        // Budget per search attempt
+constexpr int HOTSPOTS_SHOWN = 5;
+
+struct FarmOptions {
+    std::string levelDir = "assets/levels";
+    int attempts = 3000;    // Per level
+    int policy = -1;        // -1 = all, in turn
+    int threads = 0;        // 0 = one per logical core
+    float seconds = 120.0f; // Give up on an attempt after this long
+    float tickRate = FixedTimestep::DEFAULT_TICK_RATE;
+    unsigned seed = 1;
+    std::string jsonPath;
+};
+
+FarmOptions parseArgs(int argc, char* argv[]) {
+    FarmOptions opts;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--levels") == 0) {
+            opts.levelDir = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--attempts") == 0) {
+            opts.attempts = std::max(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--policy") == 0) {
+            for (int p = 0; p < POLICY_COUNT; p++) {
+                if (std::strcmp(argv[i + 1], POLICY_NAMES[p]) == 0) {
+                    opts.policy = p;
+                }
+            }
+            if (opts.policy < 0) {
+                std::fprintf(stderr, "Unknown policy: %s\n", argv[i + 1]);
+            }
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            opts.threads = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--seconds") == 0) {
+            opts.seconds = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0) {
+            opts.tickRate = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            opts.seed = static_cast<unsigned>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            opts.jsonPath = argv[i + 1];
+        } else {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+    return opts;
+}
+
+// A level under test and every treasure in it, in file order
+struct LevelInfo {
+    std::string path;
+    std::string name;
+    float length = 0.0f;
+    std::vector<Treasure> treasures;
+};
+
+// Marks which of LevelInfo::treasures a run collected. Treasures are
+// matched by position: a streamed level's list holds only the resident
+// chunks, so those are scanned every tick rather than once at the end.
+struct TreasureTracker {
+    const LevelInfo* info;
+    std::vector<Uint8>* collected;
+
+    void scan(const Level& level) const {
+        for (const Treasure& treasure : level.getTreasures()) {
+            if (!treasure.collected) {
+                continue;
+            }
+            for (size_t i = 0; i < info->treasures.size(); i++) {
+                if (info->treasures[i].x == treasure.x && info->treasures[i].y == treasure.y) {
+                    (*collected)[i] = 1;
+                }
+            }
+        }
+    }
+};
+
+struct RunOutcome {
+    bool completed = false;
+    float endX = 0.0f;  // Where the player died, or the finish line
+    Uint64 ticks = 0;
+    Uint64 deathTick = 0;
+};
+
+SDL_Event makeJumpEvent(bool down) {
+    SDL_Event event = {};
+    event.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+    event.key.scancode = SDL_SCANCODE_SPACE;
+    return event;
+}
+
+// One life through the level, pressing jump on the ticks shouldJump(tick)
+// picks. Stops at the first death, the finish line or maxTicks.
+template<typename JumpFn>
+RunOutcome playOnce(const LevelInfo& info, float step, Uint64 maxTicks,
+                    const TreasureTracker& treasures, JumpFn shouldJump) {
+    Simulation simulation;
+    SceneManager& scenes = simulation.getScenes();
+    Input& input = simulation.getInput();
+    scenes.push(scenes.create<PlayingScene>(info.path));
+    scenes.update(0.0f);
+    input.beginFrame();
+
+    RunOutcome outcome;
+    auto* playing = dynamic_cast<PlayingScene*>(scenes.current());
+    if (!playing) {
+        return outcome;
+    }
+    const int lives = playing->getLivesLeft();
+    const bool streaming = playing->getLevel().isStreaming();
+    bool held = false;
+    for (Uint64 tick = 0; tick < maxTicks; tick++) {
+        if (held) {
+            input.processEvent(makeJumpEvent(false));
+            held = false;
+        }
+        if (shouldJump(tick, *playing)) {
+            input.processEvent(makeJumpEvent(true));
+            held = true;
+        }
+        scenes.update(step);
+        input.beginFrame();
+        outcome.ticks = tick + 1;
+
+        if (playing->getLivesLeft() < lives) {
+            outcome.endX = playing->getPlayerWorldX();
+            outcome.deathTick = tick;
+            break;
+        }
+        if (playing->isLevelComplete()) {
+            outcome.completed = true;
+            outcome.endX = info.length;
+            break;
+        }
+        outcome.endX = playing->getPlayerWorldX();
+        if (streaming) {
+            treasures.scan(playing->getLevel());
+        }
+    }
+    treasures.scan(playing->getLevel());
+
+    while (!scenes.isEmpty()) {
+        scenes.pop();
+        scenes.update(0.0f);
+    }
+    return outcome;
+}
+
+struct Attempt {
+    int level;
+    Policy policy;
+    unsigned seed;
+};
+
+struct AttemptResult {
+    RunOutcome outcome;
+    std::vector<Uint8> treasures;  // 1 per LevelInfo::treasures entry reached
+};
+
+struct FarmContext {
+    const std::vector<LevelInfo>* levels;
+    const std::vector<Attempt>* attempts;
+    std::vector<AttemptResult>* results;
+    float step;
+    Uint64 maxTicks;
+};
+
+// Best-first search over jump ticks. Each replay starts from scratch (the
+// simulation is deterministic, so a plan always plays out the same); a
+// plan that dies spawns children with one more jump at each lookback
+// before the death, and the plan that got furthest is expanded next.
+RunOutcome searchRun(const FarmContext& farm, const LevelInfo& info, const TreasureTracker& treasures,
+                     std::mt19937& rng) {
+    struct Plan {
+        std::vector<Uint64> jumps;  // Ascending ticks
+        float reached;
+        Uint64 deathTick;
+    };
+    auto furthestFirst = [](const Plan& a, const Plan& b) { return a.reached < b.reached; };
+    std::priority_queue<Plan, std::vector<Plan>, decltype(furthestFirst)> open(furthestFirst);
+
+    auto play = [&](const std::vector<Uint64>& jumps) {
+        size_t next = 0;
+        return playOnce(info, farm.step, farm.maxTicks, treasures, [&](Uint64 tick, const PlayingScene&) {
+            if (next < jumps.size() && jumps[next] == tick) {
+                next++;
+                return true;
+            }
+            return false;
+        });
+    };
+
+    // Lookbacks in ticks, shuffled per attempt so attempts search differently
+    std::vector<Uint64> lookbacks;
+    for (Uint64 back = 2; back <= 40; back += 2) {
+        lookbacks.push_back(back);
+    }
+    std::shuffle(lookbacks.begin(), lookbacks.end(), rng);
+
+    RunOutcome best = play({});
+    int replays = 1;
+    if (!best.completed) {
+        open.push({{}, best.endX, best.deathTick});
+    }
+    while (!open.empty() && replays < SEARCH_REPLAYS && !best.completed) {
+        Plan plan = open.top();
+        open.pop();
+        Uint64 earliest = plan.jumps.empty() ? 0 : plan.jumps.back() + 1;
+        for (Uint64 back : lookbacks) {
+            if (replays >= SEARCH_REPLAYS || plan.deathTick < back || plan.deathTick - back < earliest) {
+                continue;
+            }
+            Plan child = plan;
+            child.jumps.push_back(plan.deathTick - back);
+            RunOutcome outcome = play(child.jumps);
+            replays++;
+            if (outcome.completed || outcome.endX > best.endX) {
+                best = outcome;
+            }
+            if (outcome.completed) {
+                break;
+            }
+            // Only plans that got past the parent's death are worth expanding
+            if (outcome.endX > plan.reached) {
+                child.reached = outcome.endX;
+                child.deathTick = outcome.deathTick;
+                open.push(std::move(child));
+            }
+        }
+    }
+    return best;
+}
+
+void runAttempt(const FarmContext& farm, int index) {
+    const Attempt& attempt = (*farm.attempts)[index];
+    const LevelInfo& info = (*farm.levels)[attempt.level];
+    AttemptResult& result = (*farm.results)[index];
+    result.treasures.assign(info.treasures.size(), 0);
+    TreasureTracker treasures{&info, &result.treasures};
+    std::mt19937 rng(attempt.seed);
+
+    switch (attempt.policy) {
+    case Random: {
+        std::bernoulli_distribution jump(1.0 / 20.0);
+        result.outcome = playOnce(info, farm.step, farm.maxTicks, treasures,
+                                  [&](Uint64, const PlayingScene&) { return jump(rng); });
+        break;
+    }
+    case Scripted: {
+        Uint64 interval = std::uniform_int_distribution<Uint64>(15, 60)(rng);
+        Uint64 phase = std::uniform_int_distribution<Uint64>(0, interval - 1)(rng);
+        result.outcome = playOnce(info, farm.step, farm.maxTicks, treasures,
+                                  [&](Uint64 tick, const PlayingScene&) { return tick % interval == phase; });
+        break;
+    }
+    default:
+        result.outcome = searchRun(farm, info, treasures, rng);
+        break;
+    }
+}
+
+bool loadLevelInfo(const std::string& path, LevelInfo& info) {
+    Level level;
+    if (!level.loadFromFile(path)) {
+        return false;
+    }
+    level.streamTo(0.0f, level.getLength());  // Every chunk, for the treasure list
+    if (level.hasMissingChunks()) {
+        return false;  // Unfinishable; PlayingScene would end the run at the gap
+    }
+    info.path = path;
+    info.name = level.getName();
+    info.length = level.getLength();
+    info.treasures = level.getTreasures();
+    return true;
+}
+
+// The chunk files a streamed level's manifest names, so they aren't also
+// played as levels of their own
+void addChunkFiles(const std::string& manifestPath, std::set<std::string>& chunkFiles) {
+    std::ifstream file(manifestPath);
+    try {
+        nlohmann::json data = nlohmann::json::parse(file);
+        if (!data.is_object() || !data.contains("chunkCount")) {
+            return;
+        }
+        fs::path dir = fs::path(manifestPath).parent_path();
+        std::string prefix = data.value("chunkPrefix", "");
+        int count = data.value("chunkCount", 0);
+        for (int i = 0; i < count; i++) {
+            chunkFiles.insert((dir / (prefix + std::to_string(i) + ".json")).generic_string());
+        }
+    } catch (const nlohmann::json::exception&) {
+        // Not a manifest; loadLevelInfo reports it
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    FarmOptions opts = parseArgs(argc, argv);
+
+    // Gameplay logs every treasure and death; keep only warnings and errors
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+
+    std::vector<std::string> paths;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(opts.levelDir, ec)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".json") {
+            paths.push_back(entry.path().generic_string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::set<std::string> chunkFiles;
+    for (const std::string& path : paths) {
+        addChunkFiles(path, chunkFiles);
+    }
+
+    std::vector<LevelInfo> levels;
+    for (const std::string& path : paths) {
+        if (chunkFiles.count(path)) {
+            continue;
+        }
+        LevelInfo info;
+        if (loadLevelInfo(path, info)) {
+            levels.push_back(std::move(info));
+        } else {
+            std::fprintf(stderr, "Skipping %s: not a level\n", path.c_str());
+        }
+    }
+    if (levels.empty()) {
+        std::fprintf(stderr, "No levels in %s\n", opts.levelDir.c_str());
+        return 1;
+    }
+
+    std::vector<Attempt> attempts;
+    for (int level = 0; level < (int)levels.size(); level++) {
+        for (int i = 0; i < opts.attempts; i++) {
+            Policy policy = static_cast<Policy>(opts.policy >= 0 ? opts.policy : i % POLICY_COUNT);
+            attempts.push_back({level, policy, opts.seed * 7919u + static_cast<unsigned>(attempts.size())});
+        }
+    }
+    std::vector<AttemptResult> results(attempts.size());
+
+    FixedTimestep timestep(opts.tickRate);
+    FarmContext farm = {&levels, &attempts, &results, timestep.getStep(),
+                        static_cast<Uint64>(opts.seconds * timestep.getTickRate())};
+
+    // The main thread works too, so one worker fewer than threads. Each
+    // level's attempts are spawned from a job, onto that worker's own
+    // deque; the rest steal from it, which evens out the difference in
+    // cost between policies and levels.
+    int threadCount = opts.threads > 0 ? opts.threads : SDL_GetNumLogicalCPUCores();
+    threadCount = std::max(1, std::min<int>(threadCount, (int)attempts.size()));
+
+    auto wallStart = std::chrono::steady_clock::now();
+    JobSystem jobs(threadCount - 1);
+    for (int level = 0; level < (int)levels.size(); level++) {
+        jobs.run([&jobs, &farm, &attempts, level] {
+            for (int i = 0; i < (int)attempts.size(); i++) {
+                if (attempts[i].level == level) {
+                    jobs.run([&farm, i] { runAttempt(farm, i); });
+                }
+            }
+        });
+    }
+    jobs.stop();  // Helps until every attempt is done
+    const Uint64 steals = jobs.getStealCount();
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    Uint64 totalTicks = 0;
+    for (const AttemptResult& result : results) {
+        totalTicks += result.outcome.ticks;
+    }
+    std::printf("PlaytestFarm: %zu attempts over %zu levels on %d threads in %.2f s "
+                "(%llu final-run ticks, %llu steals)\n",
+                attempts.size(), levels.size(), threadCount, wallSeconds,
+                static_cast<unsigned long long>(totalTicks), static_cast<unsigned long long>(steals));
+
+    nlohmann::json report = nlohmann::json::array();
+    for (int level = 0; level < (int)levels.size(); level++) {
+        const LevelInfo& info = levels[level];
+        int tried[POLICY_COUNT] = {};
+        int completed[POLICY_COUNT] = {};
+        std::vector<int> deathBins(static_cast<size_t>(info.length / DEATH_BIN_WIDTH) + 1, 0);
+        std::vector<int> reached(info.treasures.size(), 0);
+        int levelAttempts = 0;
+        for (size_t i = 0; i < attempts.size(); i++) {
+            if (attempts[i].level != level) {
+                continue;
+            }
+            const AttemptResult& result = results[i];
+            levelAttempts++;
+            tried[attempts[i].policy]++;
+            if (result.outcome.completed) {
+                completed[attempts[i].policy]++;
+            } else {
+                size_t bin = static_cast<size_t>(std::max(0.0f, result.outcome.endX) / DEATH_BIN_WIDTH);
+                deathBins[std::min(bin, deathBins.size() - 1)]++;
+            }
+            for (size_t t = 0; t < reached.size(); t++) {
+                reached[t] += result.treasures[t];
+            }
+        }
+
+        std::printf("\n%s (%s)\n", info.path.c_str(), info.name.c_str());
+        nlohmann::json completion = nlohmann::json::object();
+        std::printf("  completion:");
+        for (int p = 0; p < POLICY_COUNT; p++) {
+            if (tried[p] == 0) {
+                continue;
+            }
+            std::printf("  %s %.1f%% (%d/%d)", POLICY_NAMES[p], 100.0 * completed[p] / tried[p], completed[p], tried[p]);
+            completion[POLICY_NAMES[p]] = {{"attempts", tried[p]}, {"completed", completed[p]}};
+        }
+        std::printf("\n");
+
+        std::vector<int> order(deathBins.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = static_cast<int>(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return deathBins[a] > deathBins[b]; });
+        nlohmann::json hotspots = nlohmann::json::array();
+        std::printf("  death hotspots (x, deaths):\n");
+        for (int i = 0; i < (int)order.size() && deathBins[order[i]] > 0; i++) {
+            float start = order[i] * DEATH_BIN_WIDTH;
+            if (i < HOTSPOTS_SHOWN) {
+                std::printf("    %5.0f-%-5.0f %6d\n", start, start + DEATH_BIN_WIDTH, deathBins[order[i]]);
+            }
+            hotspots.push_back({{"x", start}, {"width", DEATH_BIN_WIDTH}, {"deaths", deathBins[order[i]]}});
+        }
+
+        nlohmann::json treasures = nlohmann::json::array();
+        std::printf("  treasures (x, y, points: attempts reaching it):\n");
+        for (size_t t = 0; t < info.treasures.size(); t++) {
+            const Treasure& treasure = info.treasures[t];
+            std::printf("    %5.0f %4.0f %4d: %5.1f%%%s\n", treasure.x, treasure.y, treasure.points,
+                        100.0 * reached[t] / levelAttempts, reached[t] == 0 ? "  never reached" : "");
+            treasures.push_back({{"x", treasure.x}, {"y", treasure.y}, {"points", treasure.points},
+                                 {"reached", reached[t]}});
+        }
+
+        report.push_back({{"level", info.path}, {"name", info.name}, {"attempts", levelAttempts},
+                          {"completion", completion}, {"deathHotspots", hotspots}, {"treasures", treasures}});
+    }
+
+    if (!opts.jsonPath.empty()) {
+        nlohmann::json results = {
+            {"tool", "PlaytestFarm"},
+            {"threads", threadCount},
+            {"wallSeconds", wallSeconds},
+            {"steals", steals},
+            {"levels", report},
+        };
+        std::ofstream file(opts.jsonPath);
+        if (!file.is_open()) {
+            std::fprintf(stderr, "Failed to write %s\n", opts.jsonPath.c_str());
+            return 1;
+        }
+        file << results.dump(2) << "\n";
+    }
+    return 0;
+}